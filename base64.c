@@ -0,0 +1,390 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  Classifying base64 text, such as an email attachment or a data: URI,
+    without decoding all of it.
+
+    Only a prefix is decoded, into a buffer of Base64First bytes on the
+    stack. If the result is -1, meaning that more data could change it,
+    a longer prefix is decoded and the tests are run again, up to
+    Base64Window bytes. That is too much for the stack of a small thread,
+    so the longer ones go in a buffer that each thread maps on first use.
+    Until all of the text is decoded the size of the file isn't known, so
+    the rules at negative offsets can't be answered. They see a file of
+    unknown size with an empty tail and give -1.
+
+    Both the standard and the URL-safe alphabets are accepted, with or
+    without line breaks and padding. A data: URI without ;base64 before
+    the comma has its payload %-escaped instead. That is decoded in the
+    same way, a prefix at a time.
+*/
+
+//======================================================================
+
+enum
+{
+    Base64First  = 3 << 10,     // bytes decoded at first
+    Base64Window = 3 << 14,     // and at most, past the ISO 9660 descriptor
+
+    // Marks in base64Values besides the values plus 1.
+    Base64Bad    = 0,
+    Base64Pad    = 0xFE,
+    Base64Space  = 0xFF,
+};
+
+static Byte             base64Values[256];
+static __thread Byte*   base64Buf;      // Base64Window bytes, see base64Buffer()
+static pthread_once_t   base64Once = PTHREAD_ONCE_INIT;
+static pthread_key_t    base64Key;
+
+
+
+static void
+base64ThreadExit(void* arg)
+{
+    // A later call on the thread, say from another key's destructor,
+    // maps a new buffer.
+    munmap(arg, Base64Window);
+    base64Buf = NULL;
+}
+
+
+
+static void
+base64Init()
+{
+    static const char Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    int i;
+
+    for (i = 0; i < 62; ++i)
+    {
+        base64Values[(Byte)Digits[i]] = i + 1;
+    }
+
+    base64Values['+'] = base64Values['-'] = 62 + 1;
+    base64Values['/'] = base64Values['_'] = 63 + 1;
+    base64Values['=']  = Base64Pad;
+    base64Values[' ']  = Base64Space;
+    base64Values['\t'] = Base64Space;
+    base64Values['\r'] = Base64Space;
+    base64Values['\n'] = Base64Space;
+
+    pthread_key_create(&base64Key, base64ThreadExit);
+}
+
+
+
+static Byte*
+base64Buffer()
+{
+    // The thread's buffer for the longer prefixes, or NULL.
+    if (!base64Buf)
+    {
+        // mmap() keeps the library clear of malloc().
+        void* buf = mmap(NULL, Base64Window, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (buf == MAP_FAILED)
+        {
+            return NULL;
+        }
+
+        base64Buf = (Byte*)buf;
+        pthread_setspecific(base64Key, buf);
+    }
+
+    return base64Buf;
+}
+
+
+
+typedef struct Base64 Base64;
+
+/*  Decode until there are want bytes in out or the text ends. It returns
+    False if the text isn't in the encoding.
+*/
+typedef Bool (*Base64Decoder)(Base64* b, Byte* out, size_t* outLen, size_t want);
+
+struct Base64
+{
+    const Byte* in;
+    const Byte* end;
+    Bool        done;       // all of the text is decoded
+};
+
+
+
+static Bool
+base64Decode(Base64* b, Byte* out, size_t* outLen, size_t want)
+{
+    /*  Decode until there are want bytes in out, want being a multiple
+        of 3, so that we always stop between groups of 4 characters. It
+        returns False if the text isn't base64.
+    */
+    const Byte* in  = b->in;
+    size_t      n   = *outLen;
+
+    while (n < want && !b->done)
+    {
+        uint32_t    group = 0;
+        int         k     = 0;
+
+        // The common case of 4 characters with no breaks.
+        if (b->end - in >= 4)
+        {
+            Byte v0 = base64Values[in[0]];
+            Byte v1 = base64Values[in[1]];
+            Byte v2 = base64Values[in[2]];
+            Byte v3 = base64Values[in[3]];
+
+            if (v0 - 1u < 64 && v1 - 1u < 64 && v2 - 1u < 64 && v3 - 1u < 64)
+            {
+                group = (v0 - 1) << 18 | (v1 - 1) << 12 | (v2 - 1) << 6 | (v3 - 1);
+                out[n++] = group >> 16;
+                out[n++] = group >> 8;
+                out[n++] = group;
+                in += 4;
+                continue;
+            }
+        }
+
+        while (k < 4 && in < b->end)
+        {
+            Byte v = base64Values[*in++];
+
+            if (v == Base64Space)
+            {
+                continue;
+            }
+
+            if (v == Base64Pad)
+            {
+                in = b->end;
+                break;
+            }
+
+            if (v == Base64Bad)
+            {
+                return False;
+            }
+
+            group = group << 6 | (v - 1);
+            ++k;
+        }
+
+        if (k < 4)
+        {
+            // The end of the text. A lone character is only padding.
+            b->done = True;
+            group <<= 6 * (4 - k);
+
+            if (k >= 2)
+            {
+                out[n++] = group >> 16;
+            }
+
+            if (k >= 3)
+            {
+                out[n++] = group >> 8;
+            }
+        }
+        else
+        {
+            out[n++] = group >> 16;
+            out[n++] = group >> 8;
+            out[n++] = group;
+        }
+    }
+
+    // Only trailing breaks may be left.
+    while (in < b->end && base64Values[*in] == Base64Space)
+    {
+        ++in;
+    }
+
+    if (in == b->end)
+    {
+        b->done = True;
+    }
+
+    b->in   = in;
+    *outLen = n;
+    return True;
+}
+
+
+
+static inline int
+hexValue(Byte c)
+{
+    // -1 if c isn't a hex digit.
+    return c >= '0' && c <= '9'? c - '0' :
+           c >= 'a' && c <= 'f'? c - 'a' + 10 :
+           c >= 'A' && c <= 'F'? c - 'A' + 10 : -1;
+}
+
+
+
+static Bool
+percentDecode(Base64* b, Byte* out, size_t* outLen, size_t want)
+{
+    /*  The payload of a data: URI without ;base64. A % that isn't
+        followed by two hex digits is taken as it is, as browsers do.
+    */
+    const Byte* in = b->in;
+    size_t      n  = *outLen;
+
+    while (n < want && in < b->end)
+    {
+        int hi, lo;
+
+        if (*in == '%' && b->end - in >= 3 &&
+            (hi = hexValue(in[1])) >= 0 && (lo = hexValue(in[2])) >= 0)
+        {
+            out[n++] = hi << 4 | lo;
+            in += 3;
+        }
+        else
+        {
+            out[n++] = *in++;
+        }
+    }
+
+    b->in   = in;
+    b->done = in == b->end;
+    *outLen = n;
+    return True;
+}
+
+
+
+static Bool
+base64More(Byte** buf, const Byte* first, size_t n)
+{
+    /*  Make room for a longer prefix. The first is moved from the stack
+        to the thread's buffer. It returns False if there is none.
+    */
+    if (*buf == first)
+    {
+        Byte* more = base64Buffer();
+
+        if (!more)
+        {
+            return False;
+        }
+
+        memcpy(more, first, n);
+        *buf = more;
+    }
+
+    return True;
+}
+
+
+
+int
+getMimeTypeBase64(const char* text, size_t len, const char** mime, int flags)
+{
+    Byte            first[Base64First];
+    Byte*           buf    = first;
+    Base64Decoder   decode = base64Decode;
+    Base64          b;
+    size_t          n      = 0;
+    size_t          want   = Base64First;
+    int             r;
+
+    pthread_once(&base64Once, base64Init);
+
+    b.in   = (const Byte*)text;
+    b.end  = b.in + len;
+    b.done = False;
+
+    // A data: URI has the media type and the encoding before a comma.
+    if (len >= 5 && memcmp(text, "data:", 5) == 0)
+    {
+        const Byte* comma = memchr(b.in, ',', len);
+
+        if (comma)
+        {
+            // Without ;base64 the payload is %-escaped, not base64.
+            if (comma - b.in < 5 + 7 || memcmp(comma - 7, ";base64", 7) != 0)
+            {
+                decode = percentDecode;
+            }
+
+            b.in = comma + 1;
+        }
+    }
+
+    for (;;)
+    {
+        Bool last;
+        int  t;
+
+        if (!decode(&b, buf, &n, want))
+        {
+            *mime = NULL;
+            return Fail;
+        }
+
+        if (b.done)
+        {
+            return getMimeType(buf, n, mime, flags);
+        }
+
+        // The size of the file isn't known yet.
+        last = want == Base64Window;
+        r    = getMimeTypeHeadTail(buf, n, NULL, 0, SIZE_MAX, mime, flags | MimeMagicNoTryText);
+
+        if (r > 0)
+        {
+            return r;
+        }
+
+        // A search or a rule may see more of the file in a longer prefix.
+        if (r < 0 && !last && base64More(&buf, first, n))
+        {
+            want *= 4;
+            continue;
+        }
+
+        if (flags & MimeMagicNoTryText)
+        {
+            return r;
+        }
+
+        // As in getMimeType() text is tried only when no magic matched.
+        t = tryPlainText(buf, n, mime, flags);
+        r = t > 0? Match : (r < 0 || t < 0)? Error : Fail;
+
+        if (r >= 0 || last || !base64More(&buf, first, n))
+        {
+            return r;
+        }
+
+        want *= 4;
+    }
+}
@@ -27,9 +27,16 @@
 """
 
 import sys;
+import os;
 import re;
+import getopt;
+import xml.parsers.expat;
+
+import utils;
 
 from generate import Generate;
+from corpus import Corpus;
+from reftree import RefTree, RefNodesFile;
 
 OptDebug = True
 
@@ -223,6 +230,9 @@ class Test:
 
     otherTests = {'default', 'clear', 'regex'}
 
+    # Tests written by hand in prologue.c that aren't in the magic file.
+    builtinTests = {'mpegframes'}
+
 
     def __init__(self, lnum, level, offset, testCode, testArg, parent = None):
         self.lnum     = lnum
@@ -246,6 +256,7 @@ class Test:
         self.targetOper = ""      # operator on the test argument
         self.testID     = None    # operator on the test argument
         self.priority   = 0
+        self.rank       = 0       # from a shared-mime-info priority, lower runs first
         self.invalid    = False
         self.unimplemented = False
 
@@ -366,6 +377,13 @@ class Test:
                     self.targetOper += self.target[0]
                     self.target = self.target[1:]
 
+            elif self.testCode == 'indirect':
+                # The test field is just the start of the message.
+                self.targetOper = 'x'
+
+            elif self.testCode in self.builtinTests:
+                self.targetOper = ''
+
             elif self.testCode in self.otherTests:
                 self.unimplemented = True
             else:
@@ -431,7 +449,8 @@ class Test:
         newsubs = []
 
         for t in self.subtests:
-            if t.setMime and t.setMime not in exceptions:
+            # An indirect test can lead to any MIME.
+            if t.setMime and t.setMime not in exceptions or t.testCode == 'indirect':
                 t.active = True
                 newsubs.append(t)
 
@@ -472,6 +491,10 @@ class Test:
         elif self.testCode == 'regex':  # These are very slow
             self.priority = 80
 
+        elif self.testCode == 'mpegframes':
+            # After the magic numbers but before the searches.
+            self.priority = 15
+
         else:
             self.priority = 10
 
@@ -603,7 +626,7 @@ class Offset:
         if self.offset == None:
             print >> sys.stderr, "Offset syntax error in:", field
 
-        if self.typeFlag and self.typeFlag in 'iIm':
+        if self.typeFlag and self.typeFlag in 'im':
             print >> sys.stderr, "Unimplemented offset type flag:", field
 
         if self.operand and '(' in self.operand:
@@ -718,6 +741,230 @@ def readFile(name, exceptions):
 
 
 
+#======================================================================
+
+# The shared-mime-info XML of freedesktop.org, as read by xdgmime, is the
+# other source of rules. Each <match> becomes a test at the same level as
+# it is nested, with the MIME type of its <mime-type> on the leaves. A
+# <magic> has a priority from 0 to 100, by default 50, and the rules of a
+# higher priority are tried first. This is the rank of the top-level
+# test, so the generator orders by it before its own priority.
+
+XdgSizes = {'byte': 1, 'big16': 2, 'big32': 4, 'little16': 2, 'little32': 4, 'host16': 2, 'host32': 4}
+
+XdgDefaultPriority = 50
+
+
+class XdgMatch:
+    # A <match> element as read, before it is made into tests.
+    def __init__(self, lnum, attrs):
+        self.lnum     = lnum
+        self.type     = attrs.get('type', '')
+        self.value    = attrs.get('value', '').encode('utf-8')
+        self.offset   = attrs.get('offset', '0')
+        self.mask     = attrs.get('mask')
+        self.children = []
+
+
+def xdgTarget(bytes):
+    # Bytes as a target in the magic syntax. The characters that could be
+    # taken as an operator or an escape are in hex.
+    s = ''.join([chr(b) if 32 <= b < 127 and chr(b) not in '\\=<>!&^~' else '\\x%02x' % b
+                 for b in bytes])
+    return '\\x78' if s == 'x' else s
+
+
+def xdgMaskBytes(mask, n):
+    # The mask of a string as n bytes. A short mask is padded with 0xff.
+    digits = mask[2:] if mask[:2].lower() == '0x' else mask
+    digits = digits if len(digits) % 2 == 0 else '0' + digits
+    bytes  = [int(digits[i:i + 2], 16) for i in range(0, len(digits), 2)]
+    return (bytes + [0xff] * n)[:n]
+
+
+def xdgIntBytes(match, text):
+    # The bytes of a number of the type of the match in file order.
+    n     = XdgSizes[match.type]
+    v     = int(text, 0) & ((1 << (8 * n)) - 1)
+    bytes = [(v >> (8 * i)) & 0xff for i in range(n)]
+    order = sys.byteorder if match.type.startswith('host') else 'little'
+
+    if match.type.startswith('big') or order == 'big':
+        bytes.reverse()
+    return bytes
+
+
+def xdgMaskedByte(offset, value, mask):
+    # The byte tests compare a signed char and ignore a mask so a masked
+    # byte is tested by its bits: those that must be set, those that must
+    # be clear and then the top bit on its own.
+    ones   = value & mask
+    zeros  = mask & ~value & 0xff
+    pieces = []
+
+    if ones & 0x7f:
+        pieces.append((offset, 'byte', '&0x%02x' % (ones & 0x7f)))
+
+    if zeros:
+        pieces.append((offset, 'byte', '^0x%02x' % (~zeros & 0xff)))
+
+    if ones & 0x80:
+        pieces.append((offset, 'byte', '^!0x7f'))
+
+    return pieces
+
+
+def xdgPieces(match):
+    # Return a list of (offset, test, target) that must all pass for the
+    # match, or None if it can't be done. A match compares bytes in file
+    # order whatever its type. The bytes under a full mask are strings and
+    # the others are masked bytes. Those under an empty mask are skipped.
+    (start, _, end) = match.offset.partition(':')
+    start  = int(start, 0)
+    window = int(end, 0) - start + 1 if end else 0
+
+    if match.type == 'string':
+        bytes = utils.splitStringBytes(match.value)
+        mask  = xdgMaskBytes(match.mask, len(bytes)) if match.mask else [0xff] * len(bytes)
+    elif match.type in XdgSizes:
+        bytes = xdgIntBytes(match, match.value)
+        mask  = xdgIntBytes(match, match.mask) if match.mask else [0xff] * len(bytes)
+    else:
+        print >> sys.stderr, "%d: unknown match type %s" % (match.lnum, match.type)
+        return None
+
+    if window:
+        if [m for m in mask if m != 0xff]:
+            print >> sys.stderr, "%d: a masked match with a range is not implemented" % match.lnum
+            return None
+        return [(start, 'search/%d' % window, xdgTarget(bytes))]
+
+    pieces = []
+    run    = []
+
+    for i in range(len(bytes) + 1):
+        if i < len(bytes) and mask[i] == 0xff:
+            run.append(bytes[i])
+            continue
+
+        if run:
+            pieces.append((start + i - len(run), 'string', xdgTarget(run)))
+            run = []
+
+        if i < len(bytes) and mask[i] != 0:
+            pieces.extend(xdgMaskedByte(start + i, bytes[i], mask[i]))
+
+    if mask and mask[-1] == 0:
+        # The input must still be long enough. No bit of ~0xff is set.
+        pieces.append((start + len(mask) - 1, 'byte', '^0xff'))
+
+    return pieces
+
+
+class XdgReader:
+
+    def __init__(self):
+        self.root     = Test(-1, -1, None, 'root', '')
+        self.mime     = None
+        self.rank     = 0
+        self.stack    = None        # of the open <match> elements
+        self.matches  = None        # the top-level ones of the <magic>
+
+
+    def start(self, tag, attrs):
+        if tag == 'mime-type':
+            self.mime = attrs.get('type').encode('utf-8')
+
+        elif tag == 'magic':
+            self.rank    = 100 - int(attrs.get('priority', XdgDefaultPriority))
+            self.stack   = []
+            self.matches = []
+
+        elif tag == 'match' and self.stack != None:
+            m = XdgMatch(self.parser.CurrentLineNumber, attrs)
+
+            if self.stack:
+                self.stack[-1].children.append(m)
+            else:
+                self.matches.append(m)
+
+            self.stack.append(m)
+
+
+    def end(self, tag):
+        if tag == 'match' and self.stack:
+            del self.stack[-1]
+
+        elif tag == 'magic':
+            for m in self.matches:
+                self.addMatch(m, 0, self.root)
+
+            self.stack = None
+
+
+    def addMatch(self, match, level, parent):
+        # The pieces of a match are nested, the last has the children.
+        pieces = xdgPieces(match)
+
+        if not pieces:
+            return
+
+        test = parent
+
+        for (n, (offset, code, target)) in enumerate(pieces):
+            test = Test(match.lnum, level + n, Offset(str(offset)), code, target, test)
+
+            if level + n == 0:
+                test.rank = self.rank
+
+        if match.children:
+            for m in match.children:
+                self.addMatch(m, level + len(pieces), test)
+        else:
+            test.setAction(self.mime)
+
+
+    def readFile(self, name):
+        self.parser = xml.parsers.expat.ParserCreate()
+        self.parser.StartElementHandler = self.start
+        self.parser.EndElementHandler   = self.end
+
+        try:
+            f = open(name)
+            self.parser.ParseFile(f)
+            f.close()
+
+        except (IOError, xml.parsers.expat.ExpatError), exn:
+            print >> sys.stderr, "Exception ", exn
+
+        return self.root
+
+
+
+def readXdgFile(name):
+    return XdgReader().readFile(name)
+
+
+
+def addBuiltins(root):
+    # MPEG audio frames have no magic number so the magic file needs
+    # rules for each kind of frame header at offset 0, or after an ID3
+    # tag. This finds a run of frames after any leading junk. Line 0
+    # marks it in the generated code.
+    t = Test(0, 0, Offset('0'), 'mpegframes', '', root)
+    t.setAction('audio/mpeg')
+    t.active = True
+
+
+
+def usage():
+    print >> sys.stderr, "Usage: compile.py [--corpus DIR] [--xdg FILE] [--dir DIR]"
+    print >> sys.stderr, "    --corpus DIR    write a synthetic input for each rule instead of the C code"
+    print >> sys.stderr, "    --xdg FILE      read the rules from a shared-mime-info XML file instead of magic"
+    print >> sys.stderr, "    --dir DIR       write the generated files to DIR instead of the source tree"
+
+
+
 def Main():
     (major, minor, _, _, _) = sys.version_info
 
@@ -725,17 +972,63 @@ def Main():
         print >> sys.stderr, "This needs at least version 2.7 of python"
         sys.exit(1)
 
+    corpusDir = None
+    xdgFile   = None
+    outDir    = None
+
+    try:
+        (opts, args) = getopt.getopt(sys.argv[1:], "hc:x:d:", ["help", "corpus=", "xdg=", "dir="])
+    except getopt.GetoptError, exn:
+        print >> sys.stderr, exn
+        usage()
+        sys.exit(1)
+
+    for (opt, val) in opts:
+        if opt in ("-c", "--corpus"):
+            corpusDir = val
+        elif opt in ("-x", "--xdg"):
+            xdgFile = val
+        elif opt in ("-d", "--dir"):
+            outDir = val
+        else:
+            usage()
+            sys.exit(0)
+
     exceptions = readExceptions("mime.exceptions")
-    root = readFile("magic", exceptions)
+
+    if xdgFile:
+        root = readXdgFile(xdgFile)
+    else:
+        root = readFile("magic", exceptions)
 
     root.pruneTree(exceptions)
+
+    # The built-in tests fill gaps in the magic file.
+    if not xdgFile:
+        addBuiltins(root)
+
     root.check()
 
     if OptDebug:
         root.printTree()
 
+    if corpusDir:
+        corpus = Corpus()
+        corpus.putRoot(root)
+        corpus.writeTo(corpusDir)
+        return
+
+    def output(path):
+        return os.path.join(outDir, os.path.basename(path)) if outDir else path
+
     gen = Generate()
     gen.putRoot(root)
-    gen.writeToFile("mimemagic.c")
+    gen.writeToFile(output("mimemagic.c"))
+    gen.writeIdsHeader(output("mimemagic_ids.h"))
+
+    # The same tree for the reference interpreter in the tests.
+    ref = RefTree()
+    ref.putRoot(root)
+    ref.writeToFile(output(RefNodesFile))
 
 Main()
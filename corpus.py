@@ -0,0 +1,467 @@
+
+"""
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+"""
+
+import os
+import re
+import sre_parse
+import sre_constants
+import struct
+import sys
+
+import utils
+
+#   This is a module for compile.py. For each leaf of the pruned test tree
+#   it synthesises a small buffer that passes every test on the path down
+#   to the leaf. The buffers are written to a directory along with a
+#   MANIFEST of the MIME type that each one should produce.
+#
+#   The tests are satisfied as the generated C code evaluates them, which
+#   is not always what the magic file intended. For example CompareLt is
+#   'test < value' and string matches leave doubled offsets. The point
+#   is to exercise each rule site in the generated code.
+#
+#   An input can still be recognised as something else if an earlier rule
+#   also matches it. The run_corpus script in tests reports these.
+
+#======================================================================
+
+class Unsatisfiable(Exception):
+    pass
+
+
+# (width, struct format) for the integer tests. The signed forms
+# are how the C functions convert the test value.
+intLayouts = {
+    'byte':    (1, 'b'),
+    'leshort': (2, '<h'),   'beshort': (2, '>h'),
+    'lelong':  (4, '<l'),   'belong':  (4, '>l'),
+    'lequad':  (8, '<q'),   'bequad':  (8, '>q'),
+    }
+
+# For getOffset()
+offsetLayouts = {
+    'b': (1, 'B'),  'B': (1, 'B'),
+    's': (2, '<H'), 'S': (2, '>H'),
+    'l': (4, '<L'), 'L': (4, '>L'),
+    }
+
+
+def toSigned(value, width):
+    # Wrap a value to a signed integer of the width as C would.
+    bits  = 8 * width
+    value = value & ((1 << bits) - 1)
+    if value >= (1 << (bits - 1)):
+        value -= (1 << bits)
+    return value
+
+
+def parseInt(text):
+    # A C integer, perhaps with a suffix.
+    text = text.rstrip('LlUu')
+    try:
+        if len(text) > 1 and text[0] == '0' and text[1] in '01234567':
+            return int(text, 8)
+        return int(text, 0)
+    except ValueError:
+        raise Unsatisfiable("bad integer " + text)
+
+
+
+class Image:
+    # A sparse buffer. Only the constrained bytes are present.
+
+    def __init__(self):
+        self.bytes  = {}
+        self.minLen = 0
+
+
+    def put(self, at, data):
+        if at < 0:
+            raise Unsatisfiable("negative offset")
+
+        for (i, b) in enumerate(data):
+            old = self.bytes.get(at + i)
+            if old != None and old != b:
+                raise Unsatisfiable("conflict at %d" % (at + i))
+
+        for (i, b) in enumerate(data):
+            self.bytes[at + i] = b
+
+        self.need(at + len(data))
+
+
+    def free(self, at, n):
+        # True if nothing has been put in the range yet.
+        for i in range(at, at + n):
+            if i in self.bytes:
+                return False
+        return True
+
+
+    def need(self, n):
+        self.minLen = max(self.minLen, n)
+
+
+    def end(self):
+        if self.bytes:
+            return max(max(self.bytes.keys()) + 1, self.minLen)
+        return self.minLen
+
+
+    def render(self):
+        data = bytearray(self.end())
+        for (at, b) in self.bytes.items():
+            data[at] = b
+        return data
+
+#======================================================================
+
+# POSIX bracket classes that Python's re doesn't know.
+posixClasses = {
+    '[:alpha:]':  'a-zA-Z',
+    '[:digit:]':  '0-9',
+    '[:alnum:]':  'a-zA-Z0-9',
+    '[:upper:]':  'A-Z',
+    '[:lower:]':  'a-z',
+    '[:space:]':  ' \\t\\r\\n\\f\\v',
+    '[:blank:]':  ' \\t',
+    '[:xdigit:]': '0-9a-fA-F',
+    '[:punct:]':  '!-/:-@\\[-`{-~',
+    '[:print:]':  ' -~',
+    }
+
+
+def posixToPython(pattern):
+    for (k, v) in posixClasses.items():
+        pattern = pattern.replace(k, v)
+    return pattern
+
+
+def sampleChars(items):
+    # Choose a character to satisfy a bracket expression.
+    negate = False
+    chars  = []
+
+    for (op, av) in items:
+        if op == sre_constants.NEGATE:
+            negate = True
+        elif op == sre_constants.LITERAL:
+            chars.append(chr(av))
+        elif op == sre_constants.RANGE:
+            chars.append(chr(av[0]))
+        elif op == sre_constants.CATEGORY:
+            if av == sre_constants.CATEGORY_DIGIT:
+                chars.append('0')
+            elif av == sre_constants.CATEGORY_SPACE:
+                chars.append(' ')
+            else:
+                chars.append('a')
+
+    if not negate:
+        if not chars:
+            raise Unsatisfiable("empty class")
+        return chars[0]
+
+    for c in "aZ0 x_-.":
+        if c not in chars:
+            return c
+
+    raise Unsatisfiable("negated class")
+
+
+def sampleRegex(parsed):
+    # Produce a short string matching the parsed regex.
+    s = ""
+
+    for (op, av) in parsed:
+        if op == sre_constants.LITERAL:
+            s += chr(av)
+        elif op == sre_constants.NOT_LITERAL:
+            s += 'a' if av != ord('a') else 'b'
+        elif op == sre_constants.ANY:
+            s += 'a'
+        elif op == sre_constants.IN:
+            s += sampleChars(av)
+        elif op in (sre_constants.MAX_REPEAT, sre_constants.MIN_REPEAT):
+            (lo, hi, sub) = av
+            s += sampleRegex(sub) * lo
+        elif op == sre_constants.SUBPATTERN:
+            s += sampleRegex(av[-1])
+        elif op == sre_constants.BRANCH:
+            s += sampleRegex(av[1][0])
+        elif op == sre_constants.AT:
+            if av in (sre_constants.AT_END, sre_constants.AT_END_STRING):
+                s += '\n'
+        else:
+            raise Unsatisfiable("regex op %s" % op)
+
+    return s
+
+#======================================================================
+
+class Corpus:
+
+    def __init__(self):
+        self.written  = []      # (file, mime)
+        self.skipped  = []      # (test, reason)
+
+
+    def putRoot(self, root):
+        for t in root.subtests:
+            self.putSubtree(t, [])
+
+
+    def putSubtree(self, test, path):
+        path = path + [test]
+
+        if test.setMime:
+            # Subtests are ignored once there is a MIME, see putTestContent().
+            self.putLeaf(path)
+        else:
+            for t in test.subtests:
+                self.putSubtree(t, path)
+
+
+    def putLeaf(self, path):
+        leaf  = path[-1]
+        image = Image()
+        offs  = {}      # like the offN variables in the C code
+
+        try:
+            for test in path:
+                self.satisfy(test, image, offs)
+
+            self.written.append((leaf, image.render()))
+
+        except Unsatisfiable, exn:
+            self.skipped.append((leaf, str(exn)))
+
+
+    def baseOffset(self, test, image, offs):
+        # Return the offset that the test will be applied at, arranging
+        # the pointer for an indirect offset.
+        off   = test.offset
+        outer = offs.get(test.level - 1, 0)
+
+        if off.indirect:
+            if off.typeFlag not in offsetLayouts:
+                raise Unsatisfiable("offset type " + off.typeFlag)
+
+            at = parseInt(off.offset)
+            if off.innerRelative:
+                at += outer
+
+            # Point somewhere after everything so far.
+            target = max(image.end(), at + 8) + 16
+            value  = target
+
+            if off.operator == '+':
+                value = target - parseInt(off.operand)
+            elif off.operator == '-':
+                value = target + parseInt(off.operand)
+            elif off.operator:
+                raise Unsatisfiable("offset operator " + off.operator)
+
+            (width, fmt) = offsetLayouts[off.typeFlag]
+
+            if value < 0 or value >= (1 << (8 * width)):
+                raise Unsatisfiable("indirect offset out of range")
+
+            image.put(at, bytearray(struct.pack(fmt, value)))
+            image.need(at + width + 1)      # getOffset() wants one more
+            base = target
+        else:
+            base = parseInt(off.offset)
+
+        if off.outerRelative:
+            base += outer
+
+        return base
+
+
+    def satisfy(self, test, image, offs):
+        # Add the bytes that make this test pass and update offs.
+        if test.testCode == 'default' or test.targetOper == 'x':
+            # These always pass and don't set their offset.
+            return
+
+        base = self.baseOffset(test, image, offs)
+        code = test.testCode
+
+        if code in intLayouts:
+            self.satisfyInt(test, base, image, offs)
+
+        elif code == 'string':
+            self.satisfyString(test, base, image, offs)
+
+        elif code == 'search':
+            self.satisfySearch(test, base, image, offs)
+
+        elif code == 'regex':
+            self.satisfyRegex(test, base, image, offs)
+
+        else:
+            raise Unsatisfiable("test " + code)
+
+
+    def satisfyInt(self, test, base, image, offs):
+        (width, fmt) = intLayouts[test.testCode]
+        tval = toSigned(parseInt(test.target), width)
+        oper = test.targetOper.replace('!', '')
+        neg  = '!' in test.targetOper
+
+        # The buffer byte is unsigned for byteMatch().
+        if width == 1:
+            (lo, hi) = (0, 255)
+        else:
+            (lo, hi) = (-(1 << (8 * width - 1)), (1 << (8 * width - 1)) - 1)
+
+        # Find a value v where intMatch(v, tval) is true, allowing for !.
+        if oper == '=':
+            v = tval if not neg else tval ^ 1
+        elif oper == '<':               # test < value
+            v = tval + 1 if not neg else tval
+        elif oper == '>':               # test > value
+            v = tval - 1 if not neg else tval
+        elif oper == '&':               # the bits of test are set
+            v = tval if not neg else 0
+        elif oper == '^':               # the bits outside test are clear
+            v = 0 if not neg else ~tval
+        else:
+            raise Unsatisfiable("int operator " + test.targetOper)
+
+        if v < lo or v > hi or (neg and v == tval and oper == '='):
+            raise Unsatisfiable("int value out of range")
+
+        if width == 1:
+            data = bytearray([v & 0xff])
+        else:
+            data = bytearray(struct.pack(fmt, v))
+
+        image.put(base, data)
+        offs[test.level] = base + width
+
+
+    def satisfyString(self, test, base, image, offs):
+        targ = bytearray(utils.splitStringBytes(test.target))
+        oper = test.targetOper
+        simple = not test.testFlags and test.offset.simple
+
+        if not targ:
+            raise Unsatisfiable("empty string")
+
+        if oper == '=':
+            image.put(base, targ)
+            if simple:
+                offs[test.level] = base + len(targ)
+            else:
+                # stringMatch() adds the end position to the offset.
+                offs[test.level] = base + base + len(targ)
+
+        elif oper == '=!' and simple:
+            targ[0] ^= 1
+            image.put(base, targ)
+            offs[test.level] = base     # the ! leaves it alone
+
+        elif oper in ('<', '>') and simple:
+            if oper == '<' and targ[0] > 0:
+                targ[0] -= 1
+            elif oper == '>' and targ[0] < 255:
+                targ[0] += 1
+            else:
+                raise Unsatisfiable("string comparison")
+            image.put(base, targ)
+            offs[test.level] = base + len(targ)
+
+        else:
+            raise Unsatisfiable("string operator " + oper)
+
+
+    def satisfySearch(self, test, base, image, offs):
+        # Place the target at the far end of the window if possible.
+        targ  = bytearray(utils.splitStringBytes(test.target))
+
+        if test.testLimit == None:
+            raise Unsatisfiable("search without a limit is not generated")
+
+        if test.targetOper != '=':
+            raise Unsatisfiable("search operator " + test.targetOper)
+
+        limit = parseInt(test.testLimit)
+        at    = base + limit - 1
+
+        if not image.free(at, len(targ)):
+            at = base
+
+        image.put(at, targ)
+        # stringSearch() leaves stringMatch()'s doubled offset.
+        offs[test.level] = at + at + len(targ)
+
+
+    def satisfyRegex(self, test, base, image, offs):
+        pattern = bytearray(utils.splitStringBytes(test.target))
+        pattern = posixToPython(str(pattern))
+
+        try:
+            flags  = re.M | (re.I if 'c' in test.testFlags else 0)
+            parsed = sre_parse.parse(pattern, flags)
+            sample = sampleRegex(parsed)
+            m = re.search(pattern, sample, flags)
+        except (re.error, sre_constants.error, TypeError), exn:
+            raise Unsatisfiable("regex " + str(exn))
+
+        if not m:
+            raise Unsatisfiable("regex sample doesn't match")
+
+        image.put(base, bytearray(sample))
+
+        if 's' in test.testFlags:
+            offs[test.level] = base
+        else:
+            offs[test.level] = base + m.end() - m.start()
+
+
+    def writeTo(self, dir):
+        if not os.path.isdir(dir):
+            os.makedirs(dir)
+
+        manifest = open(os.path.join(dir, "MANIFEST"), "w")
+
+        for (leaf, data) in self.written:
+            name = "line%05d.bin" % leaf.lnum
+            f = open(os.path.join(dir, name), "wb")
+            f.write(data)
+            f.close()
+            print >> manifest, "%s\t%s" % (name, leaf.setMime)
+
+        manifest.close()
+
+        print >> sys.stderr, "Wrote %d inputs to %s, skipped %d leaves" % \
+                                (len(self.written), dir, len(self.skipped))
+
+        for (leaf, reason) in self.skipped:
+            print "corpus skipping line %d: %s" % (leaf.lnum, reason)
@@ -45,12 +45,9 @@ utf8Byte(const Byte** bufp)
 
 
 
-Result
-tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
+static Result
+plainText(const Byte* buf, size_t len, MimeId* mime)
 {
-    /*  Ensure that the mime string is a constant and doesn't
-        need to be freed.
-    */
     Bool        ascii = True;
     Bool        utf8  = True;
     const Byte* bp   = buf;
@@ -59,6 +56,7 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
     static const size_t Limit = 1024;   // Limit the search to 1024 bytes
     size_t      nuls    = 0;
     size_t      funnies = False;
+    Bool        sure;                   // more data won't make it text
 
     if (len > Limit)
     {
@@ -89,14 +87,14 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
 
     if (ascii)
     {
-        *mime = "text/plain; charset=US-ASCII";
+        *mime = TextASCII;
         return Match;
     }
 
     // UTF-8 has a BOM of EF BB BF
     if (len >= 3 && buf[0] == 0xEF && buf[1] == 0xBB && buf[2] == 0xBF)
     {
-        *mime = "text/plain; charset=UTF-8";
+        *mime = TextUTF8;
         return Match;
     }
 
@@ -104,7 +102,7 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
     {
         if (buf[0] == 0xFE && buf[1] == 0xFF || buf[0] == 0xFF && buf[1] == 0xFE)
         {
-            *mime = "text/plain; charset=UTF-16";
+            *mime = TextUTF16;
             return Match;
         }
     }
@@ -115,6 +113,7 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
     */
     uend = bend - 4;
     utf8 = True;
+    sure = nuls > 0;
 
     nuls    = 0;
     funnies = False;
@@ -126,6 +125,7 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
         if (b < 0)
         {
             utf8 = False;
+            sure = True;
             break;
         }
 
@@ -144,11 +144,111 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
 
     if (utf8)
     {
-        *mime = "text/plain; charset=UTF-8";
+        *mime = TextUTF8;
         return Match;
     }
 
-    return Error;
+    /*  A NUL or a byte that isn't UTF-8 rules out text for good. If it
+        was only too many funny characters then more data allows more.
+    */
+    return sure? Fail : Error;
+}
+
+
+
+Result
+tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
+{
+    /*  Ensure that the mime string is a constant and doesn't
+        need to be freed.
+    */
+    MimeId  id = NoMime;
+    Result  r  = plainText(buf, len, &id);
+
+    *mime = r > 0? mimeNames[id] : NULL;
+    return r;
+}
+
+
+
+static int
+findMimeId(
+    const Byte* buf,
+    size_t      len,
+    unsigned int* mimeId,
+    int         flags,
+    const MimeMagicExecutor* exec,
+    const Tail* tail,
+    MimeMagicMatch* match
+    )
+{
+    MimeId  id   = NoMime;
+    Result  r    = Error;
+
+#ifdef MIMEMAGIC_STATS
+    Bool     text  = False;
+    uint64_t start = statsClock();
+#endif
+
+#ifdef MIMEMAGIC_SAMPLE
+    Bool     sampled     = sampleDue();
+    uint64_t sampleStart = sampled? sampleClock() : 0;
+#endif
+
+    if (len > 0)
+    {
+        //testCount = 0;
+
+        r = exec? runTestsParallel(buf, len, &id, flags, exec) : runTests(buf, len, &id, flags, 0, tail, match);
+
+        //printf ("test count %d\n", testCount);
+
+        // Try text if no magic matched. It's only an error if more
+        // data could change one answer or the other.
+        if (r <= 0 && !(flags & MimeMagicNoTryText))
+        {
+            Result t = plainText(buf, len, &id);
+
+            TraceTest(0, t, len);
+
+            r = t > 0? Match : (r < 0 || t < 0)? Error : Fail;
+
+#ifdef MIMEMAGIC_STATS
+            text = True;
+#endif
+
+            if (t > 0 && match)
+            {
+                match->line  = 0;
+                match->depth = 0;
+                match->start = 0;
+                match->end   = len;
+            }
+        }
+    }
+
+    *mimeId = r > 0? id : NoMime;
+
+#ifdef MIMEMAGIC_STATS
+    statsRecord(r, text, id, statsClock() - start);
+#endif
+
+#ifdef MIMEMAGIC_SAMPLE
+    if (Unlikely(sampled))
+    {
+        sampleRecord(buf, len, tail, r, *mimeId, flags, sampleClock() - sampleStart);
+    }
+#endif
+
+    return r;
+}
+
+
+
+int
+getMimeId(const Byte* buf, size_t len, unsigned int* mimeId, int flags)
+{
+    return findMimeId(buf, len, mimeId, flags, NULL, NULL, NULL);
 }
 
 
@@ -156,26 +256,136 @@ tryPlainText(const Byte* buf, size_t len, const char** mime, int flags)
 int
 getMimeType(const Byte* buf, size_t len, const char** mime, int flags)
 {
-    *mime = NULL;
+    unsigned int    id;
+    int             r = findMimeId(buf, len, &id, flags, NULL, NULL, NULL);
+
+    *mime = mimeNames[id];
+    return r;
+}
+
+
+
+int
+getMimeTypeMatch(const Byte* buf, size_t len, const char** mime, MimeMagicMatch* match, int flags)
+{
+    unsigned int    id;
+    int             r;
 
-    if (len == 0)
+    memset(match, 0, sizeof(*match));
+    r = findMimeId(buf, len, &id, flags, NULL, NULL, match);
+
+    if (r <= 0)
     {
-        return Error;
+        memset(match, 0, sizeof(*match));
     }
 
-    //testCount = 0;
+    *mime = mimeNames[id];
+    return r;
+}
+
+
 
-    Result r = runTests(buf, len, mime);
+int
+getMimeTypeParallel(
+    const Byte* buf,
+    size_t      len,
+    const char** mime,
+    int         flags,
+    const MimeMagicExecutor* executor,
+    size_t      threshold
+    )
+{
+    unsigned int    id;
+    int             r;
 
-    //printf ("test count %d\n", testCount);
+    if (threshold == 0)
+    {
+        threshold = MimeMagicParallelThreshold;
+    }
 
-    if (r < 0)
+    if (len < threshold)
     {
-        if (!(flags & MimeMagicNoTryText))
-        {
-            r = tryPlainText(buf, len, mime, flags);
-        }
+        executor = NULL;
     }
 
+    r = findMimeId(buf, len, &id, flags, executor, NULL, NULL);
+    *mime = mimeNames[id];
     return r;
 }
+
+
+
+int
+getMimeTypeHeadTail(
+    const Byte* head,
+    size_t      headLen,
+    const Byte* tail,
+    size_t      tailLen,
+    size_t      size,
+    const char** mime,
+    int         flags
+    )
+{
+    /*  The buffers are trimmed to the file so that the positions in them
+        agree. If the head has all of the file the tail isn't needed.
+    */
+    unsigned int    id;
+    Tail            t;
+    int             r;
+
+    if (headLen > size)
+    {
+        headLen = size;
+    }
+
+    if (tailLen > size)
+    {
+        tail   += tailLen - size;
+        tailLen = size;
+    }
+
+    if (headLen == size)
+    {
+        tail    = head;
+        tailLen = headLen;
+    }
+
+    t.buf  = tail;
+    t.len  = tailLen;
+    t.size = size;
+
+    r = findMimeId(head, headLen, &id, flags, NULL, &t, NULL);
+    *mime = mimeNames[id];
+    return r;
+}
+
+
+
+void
+getMimeTypeBatch(
+    const Byte* const* bufs,
+    const size_t* lens,
+    size_t      count,
+    const char** mimes,
+    int*        results,
+    int         flags
+    )
+{
+    size_t i;
+
+    for (i = 0; i < count; ++i)
+    {
+        unsigned int id;
+
+        results[i] = findMimeId(bufs[i], lens[i], &id, flags, NULL, NULL, NULL);
+        mimes[i]   = mimeNames[id];
+    }
+}
+
+
+
+const char*
+mimeMagicName(unsigned int id)
+{
+    return id < MimeCount? mimeNames[id] : NULL;
+}
@@ -25,6 +25,7 @@
     SUCH DAMAGE.
 """
 
+import re
 import sys
 
 import utils
@@ -34,6 +35,59 @@ from utils import OStream
 PrologueFile = "prologue.c"
 EpilogueFile = "epilogue.c"
 
+# These are hand-written files that are copied in after runTests() and
+# before the epilogue.  They may use the generated tables.
+SupportFiles = ["stats.c", "parallel.c", "carve.c", "base64.c", "info.c", "trace.c", "sample.c"]
+
+# runTests() is split into at most this many segments. The first has the
+# cheap top-level tests and the rest share out the expensive ones so that
+# parallel.c can run them concurrently. A CarveAnchor has a bit for each.
+MaxSegments = 8
+
+# Top-level tests with this priority or more are the expensive ones.
+CostlyPriority = 20
+
+# A top-level test at a fixed offset of at least PageBytes is a far test.
+# It may fault in a page of a memory-mapped file that no other test reads,
+# so it costs as much as scanning PageCost bytes. The first MaxDeferred
+# far tests can be put off, see deferFar() in prologue.c.
+PageBytes   = 4096
+PageCost    = 256
+MaxDeferred = 32
+
+# A carving anchor is CarveBytes known bytes of a top-level test that are
+# at most CarveMaxShift bytes into the file. See carve.c.
+CarveBytes    = 4
+CarveMaxShift = 15
+
+# The subtests of a top-level test only run once its own test passes,
+# which is rare. If they come to at least this many lines they are moved
+# to a cold function so that the top-level tests are packed together.
+ColdLines = 8
+
+# These MIME types are produced by the hand-written code in the epilogue.
+# They take the first ids, in this order, to match the enum in prologue.c.
+FixedMimes = [
+    "text/plain; charset=US-ASCII",
+    "text/plain; charset=UTF-8",
+    "text/plain; charset=UTF-16",
+    ]
+
+# The MIME types that the support files use from mimemagic_ids.h. They
+# are numbered even if no rule gives them so that the files compile with
+# the rules of either the magic file or shared-mime-info. Those that no
+# rule gives come last so that they don't move the ids of the others.
+SupportMimes = [
+    "audio/x-wav",
+    "image/bmp",
+    "image/gif",
+    "image/jpeg",
+    "image/png",
+    "image/webp",
+    "image/x-ms-bmp",
+    "video/x-mng",
+    ]
+
 #   This is a module for compile.py. It generates the C code for the
 #   decision tree.
 
@@ -86,27 +140,408 @@ class Generate:
         # This may throw
         self.code  = OStream()
         self.data  = OStream()
-        self.decls = OStream()
 
         self.mapCount = 1;
+
+        # Map each MIME string to its index in the mimeNames table.
+        self.mimeIds = {}
+
+        # The code of each segment of runTests().
+        self.segments = []
+
+        # The code of each far test that can be put off, in order.
+        self.farTests = []
+
+        # The code of the subtests that were moved out to cold functions.
+        self.coldTests = []
+
+        # Map the first bytes of each carving anchor to the set of MIME
+        # ids that its rules can give.
+        self.carveAnchors = {}
          
 
 
     def putRoot(self, root):
-        self.putTests(root.subtests, 1)
+        self.assignMimeIds(root)
+
+        # The cheap tests go in the first segment. The expensive ones are
+        # shared out over the rest in the order that putTests() would put
+        # them, so running the segments in turn runs the same tests in the
+        # same order as one function would. With ranks, the cheap tests of
+        # a later rank follow the expensive ones of the rank before.
+        ordered = sorted(root.subtests, key = self.testOrder)
+        n = 0
+
+        while n < len(ordered) and ordered[n].priority < CostlyPriority:
+            n += 1
+
+        cheap  = ordered[:n]
+        costly = ordered[n:]
+
+        self.putTests(cheap, 1)
+        self.segments.append(self.code)
+
+        for t in cheap:
+            self.addCarveAnchor(t, 0)
+
+        for group in self.groupSegments(costly, MaxSegments - 1):
+            self.code = OStream()
+
+            for run in self.segmentRuns(group):
+                # A parallel run stops here once an earlier segment matched.
+                print >> self.code
+                print >> self.code, "%sif (cancelled(state)) return Fail;" % mkIndent(1)
+                self.putTests(run, 1)
+
+            for t in group:
+                self.addCarveAnchor(t, len(self.segments))
+
+            self.segments.append(self.code)
+
+
+
+    def testCost(self, test):
+        # A rough static cost of a test and its subtests. Searches and
+        # regular expressions cost the bytes they may scan.
+        cost = 1
+
+        if test.testCode in ('search', 'regex'):
+            limit = int(test.testLimit, 0) if test.testLimit != None else 0
+
+            if 'l' in test.testFlags:
+                limit *= 80
+
+            cost += max(limit, 64)
+
+        if self.farOffset(test) != None:
+            cost += PageCost
+
+        for t in test.subtests:
+            cost += self.testCost(t)
+
+        return cost
+
+
+
+    def farOffset(self, test):
+        # The offset of a far test or None.
+        off = test.offset
+
+        if test.level != 0 or not off.simple:
+            return None
+
+        try:
+            n = int(off.offset, 0)
+        except ValueError:
+            return None
+
+        return n if n >= PageBytes else None
+
+
+
+    def fromEnd(self, off):
+        # A negative offset counts back from the end of the file. For an
+        # indirect offset this is where the offset is read from.
+        relative = off.innerRelative if off.indirect else off.outerRelative
+        return off.offset.startswith('-') and not relative
+
+
+
+    def readsTail(self, test):
+        # If the indirect offset of the test may be read from the tail.
+        off = test.offset
+        return off.indirect and \
+               (self.fromEnd(off) or off.innerRelative and self.inTail(test.parent))
+
+
+
+    def inTail(self, test):
+        # If the data of the test may be in the tail of the file. Its
+        # offset is a position in the file and genOffset() finds the
+        # buffer that holds it at run time.
+        off = test.offset
+
+        # An indirect test runs the tree on the head from its offset.
+        if test.level < 0 or test.testCode == 'indirect':
+            return False
+
+        if off.indirect:
+            return self.readsTail(test) or off.outerRelative and self.inTail(test.parent)
+
+        if off.outerRelative:
+            return self.inTail(test.parent)
+
+        return self.fromEnd(off)
+
+
+
+    def bufArgs(self, test):
+        # The buffer arguments of a test, see genOffset().
+        return 'view.buf, view.len' if self.inTail(test) else 'buf, len'
+
+
+
+    def isFarTest(self, test):
+        # A far test that gets its own function so that it can be put off.
+        return self.farOffset(test) != None and len(self.farTests) < MaxDeferred
+
+
+
+    def testOrder(self, test):
+        # Tests are run by rank and then by priority. Only the rules from
+        # shared-mime-info have a rank, see readXdgFile() in compile.py.
+        return (test.rank, test.priority)
+
+
+
+    def segmentRuns(self, tests):
+        # Split a segment's tests into runs for putTests(). An expensive
+        # test is a run by itself. The cheap tests of a rank stay together
+        # so that they can share a string map.
+        runs = []
+
+        for t in tests:
+            if runs and t.priority < CostlyPriority and runs[-1][-1].priority < CostlyPriority \
+                    and runs[-1][-1].rank == t.rank:
+                runs[-1].append(t)
+            else:
+                runs.append([t])
+
+        return runs
+
+
+
+    def groupSegments(self, tests, count):
+        # Cut the list into at most count runs of about the same cost,
+        # keeping the order.
+        costs  = [self.testCost(t) for t in tests]
+        total  = sum(costs)
+        groups = []
+        group  = []
+        acc    = 0
 
-        # We need an 'offN' variable for each level of nesting.
-        #print 'root depth', root.depth()
-        decl = []
-        for n in range(root.depth()):
-            decl.append('off%d' % n)
-        print >> self.decls, "%ssize_t %s;" % (mkIndent(1), ', '.join(decl))
+        for (t, c) in zip(tests, costs):
+            group.append(t)
+            acc += c
+
+            if acc * count >= total * (len(groups) + 1) and len(groups) < count - 1:
+                groups.append(group)
+                group = []
+
+        if group:
+            groups.append(group)
+
+        return groups
+
+
+
+    def assignMimeIds(self, root):
+        # Number the MIME types. Id 0 means no MIME. The fixed ones come
+        # first and the rest are sorted so that the ids are predictable.
+        found = set()
+
+        def collect(test):
+            if test.setMime:
+                found.add(test.setMime)
+            for t in test.subtests:
+                collect(t)
+
+        collect(root)
+
+        names = list(FixedMimes)
+        names.extend(sorted(found - set(FixedMimes)))
+        names.extend([m for m in SupportMimes if m not in names])
+
+        for (n, mime) in enumerate(names):
+            self.mimeIds[mime] = n + 1
+
+
+
+    def anchorBytes(self, test):
+        # The offset of a top-level test and the bytes that it needs
+        # there, or None. The t and b flags don't change the bytes. A
+        # search may match further on, but a file that starts where the
+        # anchor is found has the bytes at the offset.
+        off = test.offset
+
+        if not off.simple or test.testMask or test.targetOper != '=':
+            return None
+
+        try:
+            start = int(off.offset, 0)
+        except ValueError:
+            return None
+
+        if start < 0 or start > CarveMaxShift:
+            return None
+
+        if test.testCode in ('string', 'search') and set(test.testFlags) <= set('tb'):
+            return (start, utils.splitStringBytes(test.target))
+
+        widths = {'belong': 4, 'lelong': 4, 'bequad': 8, 'lequad': 8}
+
+        if test.testCode in widths:
+            width = widths[test.testCode]
+
+            try:
+                value = int(test.target, 0) & ((1 << (8 * width)) - 1)
+            except ValueError:
+                return None
+
+            bytes = [(value >> (8 * n)) & 0xff for n in range(width)]
+
+            if test.testCode.startswith('be'):
+                bytes.reverse()
+            return (start, bytes)
+
+        return None
+
+
+
+    def addCarveAnchor(self, test, segment):
+        # A test is an anchor if CarveBytes of its bytes, at most
+        # CarveMaxShift into the file, aren't all the same and at least
+        # two of them are not zero, as runs of one byte and small integers
+        # are common in disk images. The first such run is the key. Its
+        # rules mustn't run the tree again. The anchor notes the segments
+        # that hold its rules.
+        found = self.anchorBytes(test)
+
+        if not found:
+            return
+
+        (start, bytes) = found
+        key = None
+
+        for j in range(len(bytes) - CarveBytes + 1):
+            k = bytes[j : j + CarveBytes]
+
+            if start + j > CarveMaxShift:
+                break
+
+            if len(set(k)) > 1 and len([b for b in k if b != 0]) >= 2:
+                key = (tuple(k), start + j)
+                break
+
+        if not key:
+            return
+
+        mimes = set()
+
+        def collect(t):
+            if t.testCode == 'indirect':
+                return False
+            if t.setMime:
+                mimes.add(self.mimeIds[t.setMime])
+            return all([collect(sub) for sub in t.subtests])
+
+        if collect(test):
+            (ids, segments) = self.carveAnchors.setdefault(key, (set(), set()))
+            ids.update(mimes)
+            segments.add(segment)
+
+
+
+    def putCarveTables(self, out):
+        # The anchors sorted by their bytes as carveWord() loads them and
+        # then by how far they are into the file, with a bit for each
+        # segment that holds their rules and the MIME ids they can give.
+        word    = lambda key: sum([b << (8 * n) for (n, b) in enumerate(key)])
+        anchors = sorted(self.carveAnchors.items(), key = lambda item: (word(item[0][0]), item[0][1]))
+        mimes   = []
+        ind1    = mkIndent(1)
+
+        print >> out, "\n#define CarveMaxShift %d\n" % CarveMaxShift
+        print >> out, "static const CarveAnchor carveAnchors[] = {"
+        for ((key, shift), (ids, segments)) in anchors:
+            mask = sum([1 << n for n in segments])
+            print >> out, "%s{0x%08x, %d, 0x%02x, %d, %d},%s// %s" % \
+                    (ind1, word(key), shift, mask, len(mimes), len(ids), ind1, utils.bytesToC(list(key)))
+            mimes.extend(sorted(ids))
+        print >> out, "};"
+        print >> out, "#define CarveAnchorCount %d\n" % len(anchors)
+
+        print >> out, "static const MimeId carveMimes[] = {"
+        for n in range(0, len(mimes), 16):
+            print >> out, "%s%s," % (ind1, ", ".join([str(m) for m in mimes[n : n + 16]]))
+        print >> out, "};\n"
+
+
+
+    def mimeRef(self, mime):
+        # Return the C text for the id of a MIME type.
+        return "%d" % self.mimeIds[mime]
+
+
+
+    def mimeIdentifier(self, mime):
+        # A C identifier from a MIME type, e.g. application_vnd_ms_opentype.
+        return "_".join(re.split("[^A-Za-z0-9]+", mime)).strip("_")
+
+
+
+    def writeIdsHeader(self, path):
+        # The public header of the ids. They are only valid for the
+        # library built with this header.
+        out   = open(path, "w")
+        ind1  = mkIndent(1)
+        names = sorted(self.mimeIds.keys(), key = lambda m: self.mimeIds[m])
+        idents = [self.mimeIdentifier(m) for m in names]
+
+        if len(set(idents)) != len(idents):
+            raise Exception("The MIME identifiers are not unique")
+
+        print >> out, "/*  This file is generated by compile.py. Don't edit it."
+        print >> out, ""
+        print >> out, "    These are the ids of the MIME types that getMimeId() returns. They"
+        print >> out, "    change when the magic file changes so they should only be used with"
+        print >> out, "    the library that was built with this header and not stored."
+        print >> out, "*/"
+        print >> out, ""
+        print >> out, "#ifndef MIME_MAGIC_IDS_HH"
+        print >> out, "#define MIME_MAGIC_IDS_HH"
+        print >> out, ""
+        print >> out, "enum MimeMagicId"
+        print >> out, "{"
+        print >> out, "%sMimeMagicIdNone = 0," % ind1
+        for (m, ident) in zip(names, idents):
+            print >> out, "%sMimeMagic_%s = %d,    // %s" % (ind1, ident, self.mimeIds[m], m)
+        print >> out, "%sMimeMagicIdCount = %d" % (ind1, len(names) + 1)
+        print >> out, "};"
+        print >> out, ""
+        print >> out, "#ifdef __cplusplus"
+        print >> out, "namespace mimemagic"
+        print >> out, "{"
+        print >> out, "namespace id"
+        print >> out, "{"
+        for ident in idents:
+            print >> out, "%sconstexpr MimeMagicId %s = MimeMagic_%s;" % (ind1, ident, ident)
+        print >> out, "}"
+        print >> out, "}"
+        print >> out, "#endif /* __cplusplus */"
+        print >> out, ""
+        print >> out, "#endif // MIME_MAGIC_IDS_HH"
+        out.close()
+
+
+
+    def putMimeNames(self, out):
+        # The table of MIME strings indexed by the ids.
+        ind1  = mkIndent(1)
+        names = sorted(self.mimeIds.keys(), key = lambda m: self.mimeIds[m])
+
+        print >> out, "\n#define MimeCount %d\n" % (len(names) + 1)
+        print >> out, "static const char* const mimeNames[MimeCount] = {"
+        print >> out, "%sNULL," % ind1
+        for m in names:
+            print >> out, "%s%s,    // %d" % (ind1, utils.quoteForC(m), self.mimeIds[m])
+        print >> out, "};"
 
 
 
     def putTests(self, tests, level):
-        # Partition them by priority
-        parts = utils.partitionByKey(tests, lambda t: t.priority)
+        # Partition them by rank and priority
+        parts = utils.partitionByKey(tests, self.testOrder)
         prios = parts.keys()
         prios.sort()
 
@@ -130,16 +565,48 @@ class Generate:
             self.putStringMap(strMime, level)
 
         for t in strEquals2:
-            self.putSimpleString(t, level)
+            self.putOneTest(t, level, self.putSimpleString)
 
         for t in strNotEquals:
-            self.putSimpleString(t, level)
+            self.putOneTest(t, level, self.putSimpleString)
 
         for t in strOtherOper:
-            self.putSimpleString(t, level)
+            self.putOneTest(t, level, self.putSimpleString)
 
         for t in rest2:
-            self.putGeneralTest(t, level)
+            self.putOneTest(t, level, self.putGeneralTest)
+
+
+
+    def putOneTest(self, test, level, put):
+        # A far test goes in a function of its own, farTestN(), so that
+        # runDeferred() can run it later. The segment calls it unless
+        # deferFar() puts it off.
+        if not self.isFarTest(test):
+            put(test, level)
+            return
+
+        indent = mkIndent(level)
+        ind2   = mkIndent(level + 1)
+        n      = len(self.farTests)
+        code   = self.code
+
+        self.code = OStream()
+        put(test, 1)
+        self.farTests.append(self.code)
+        self.code = code
+
+        print >> self.code
+        print >> self.code, '%s// line %s, page %d' % (indent, test.lnum, self.farOffset(test) // PageBytes)
+        print >> self.code, '%sif (!deferFar(buf, len, %s, state, %d))' % (indent, test.offset.offset, n)
+        print >> self.code, '%s{' % indent
+        print >> self.code, '%srslt = farTest%d(buf, len, mime, state);' % (ind2, n)
+        print >> self.code, '%sif (rslt < 0) haveError = True;' % ind2
+        print >> self.code, '%sif (rslt > 0)' % ind2
+        print >> self.code, '%s{' % ind2
+        print >> self.code, '%sreturn Match;' % mkIndent(level + 2)
+        print >> self.code, '%s}' % ind2
+        print >> self.code, '%s}' % indent
 
 
     def putSimpleString(self, test, level):
@@ -159,8 +626,9 @@ class Generate:
             print >> self.code, '%s// line %s' %(indent, test.lnum)
             if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-            print >> inner, '%srslt = %s(buf, len, %s, sizeof(%s) - 1, &%s);' % \
-                                        (indent, func, targ, targ, ovar)
+            print >> inner, '%srslt = %s(%s, %s, sizeof(%s) - 1, &%s);' % \
+                                        (indent, func, self.bufArgs(test), targ, targ, ovar)
+            self.putTrace(inner, test, indent)
             print >> inner, '%sif (rslt < 0) haveError = True;' % indent
 
             self.genOffset(test, str(inner), level)
@@ -193,15 +661,14 @@ class Generate:
             # Get a string literal which we can use sizeof on.
             bytes = utils.splitStringBytes(t.target)
             targ  = utils.bytesToC(bytes)
-            mime  = utils.quoteForC(t.setMime)
-            triple = (bytes, targ, mime)
-            targets.append(triple)
+            mime  = self.mimeRef(t.setMime)
+            targets.append((bytes, targ, mime, t.lnum))
 
-        targets.sort(key = lambda triple: triple[0])
+        targets.sort(key = lambda entry: entry[0])
 
         print >> self.data, "\nstatic StringMap %s[] = {" % mapName
-        for (bytes, targ, mime) in targets:
-            print >> self.data, '%s{%s,    sizeof(%s) - 1,    %s},' % (ind1, targ, targ, mime)
+        for (bytes, targ, mime, lnum) in targets:
+            print >> self.data, '%s{%s,    sizeof(%s) - 1,    %s,    %s},' % (ind1, targ, targ, mime, lnum)
         print >> self.data, "};"
         print >> self.data, "static const size_t %sCount = %d;" % (mapName, len(targets))
 
@@ -215,7 +682,8 @@ class Generate:
         print >> self.code, '%s// line %s' %(indent, testLine)
         if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-        print >> self.code, '%srslt = stringEqualMap(buf, len, %s, %sCount, mime);' % (indent, mapName, mapName)
+        print >> self.code, '%srslt = stringEqualMap(buf, len, %s, %sCount, mime, state);' % (indent, mapName, mapName)
+        self.putTrace(self.code, tests[0], indent, '0')
         print >> self.code, '%sif (rslt < 0) haveError = True;' % indent
         print >> self.code, '%sif (rslt > 0)' % indent
         print >> self.code, '%s{' % indent
@@ -240,12 +708,11 @@ class Generate:
         for t in tests:
             # Get a string literal which we can use sizeof on.
             mask = '0xffff' if t.testMask == None else t.testMask
-            triple = (t.target, mask, utils.quoteForC(t.setMime))
-            targets.append(triple)
+            targets.append((t.target, mask, self.mimeRef(t.setMime), t.lnum))
 
         print >> self.data, "\nstatic ShortMap %s[] = {" % mapName
-        for (targ, mask, mime) in targets:
-            print >> self.data, '%s{%s,    %s,    %s},' % (ind1, targ, mask, mime)
+        for (targ, mask, mime, lnum) in targets:
+            print >> self.data, '%s{%s,    %s,    %s,    %s},' % (ind1, targ, mask, mime, lnum)
         print >> self.data, "};"
         print >> self.data, "static const size_t %sCount = %d;" % (mapName, len(targets))
 
@@ -259,7 +726,8 @@ class Generate:
         print >> self.code, '%s// line %s' %(indent, testLine)
         if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-        print >> self.code, '%srslt = beShortGroup(buf, len, %s, %sCount, mime);' % (indent, mapName, mapName)
+        print >> self.code, '%srslt = beShortGroup(buf, len, %s, %sCount, mime, state);' % (indent, mapName, mapName)
+        self.putTrace(self.code, tests[0], indent, '0')
         print >> self.code, '%sif (rslt < 0) haveError = True;' % indent
         print >> self.code, '%sif (rslt > 0)' % indent
         print >> self.code, '%s{' % indent
@@ -278,7 +746,45 @@ class Generate:
         indent  = mkIndent(level)
         ovar    = mkOvar(test.level)
 
-        if test.testCode == 'default' or test.targetOper == 'x':
+        if test.testCode == 'indirect':
+            # Run the whole tree from the offset. A match there is the
+            # result, there is no MIME here.
+            inner = OStream()
+
+            if test.level == 0:
+                print >> self.code
+
+            print >> self.code, '%s// line %s' %(indent, test.lnum)
+            if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
+
+            print >> inner, '%srslt = indirectMatch(buf, len, %s, mime, state);' % (indent, ovar)
+            self.putTrace(inner, test, indent)
+            print >> inner, '%sif (rslt < 0) haveError = True;' % indent
+            print >> inner, '%sif (rslt > 0)' % indent
+            print >> inner, '%s{' % indent
+            print >> inner, '%sreturn Match;' % mkIndent(level + 1)
+            print >> inner, '%s}' % indent
+
+            self.genOffset(test, str(inner), level)
+
+
+        elif test.testCode == 'mpegframes':
+            inner = OStream()
+
+            if test.level == 0:
+                print >> self.code
+
+            print >> self.code, '%s// line %s, built in' %(indent, test.lnum)
+            if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
+
+            print >> inner, '%srslt = mpegFrames(%s, &%s);' % (indent, self.bufArgs(test), ovar)
+            self.putTrace(inner, test, indent)
+            print >> inner, '%sif (rslt < 0) haveError = True;' % indent
+
+            self.genOffset(test, str(inner), level)
+            self.putTestBody(test, level)
+
+        elif test.testCode == 'default' or test.targetOper == 'x':
             # Always match. The 'clear' operation doesn't seem to
             # be relevant to generating a MIME type.
             self.putTestContent(test, level)
@@ -308,8 +814,9 @@ class Generate:
             print >> self.code, '%s// line %s' %(indent, test.lnum)
             if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-            print >> inner, '%srslt = stringMatch(buf, len, %s, sizeof(%s) - 1, &%s, %s, %s);' % \
-                                        (indent, targ, targ, ovar, oper, flags)
+            print >> inner, '%srslt = stringMatch(%s, %s, sizeof(%s) - 1, &%s, %s, %s);' % \
+                                        (indent, self.bufArgs(test), targ, targ, ovar, oper, flags)
+            self.putTrace(inner, test, indent)
             print >> inner, '%sif (rslt < 0) haveError = True;' % indent
 
             self.genOffset(test, str(inner), level)
@@ -340,8 +847,9 @@ class Generate:
                 print >> self.code, '%s// line %s' %(indent, test.lnum)
                 if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-                print >> inner, '%srslt = stringSearch(buf, len, %s, sizeof(%s) - 1, &%s, %s, %s);' % \
-                                            (indent, targ, targ, ovar, limit, flags)
+                print >> inner, '%srslt = stringSearch(%s, %s, sizeof(%s) - 1, &%s, %s, %s);' % \
+                                            (indent, self.bufArgs(test), targ, targ, ovar, limit, flags)
+                self.putTrace(inner, test, indent)
                 print >> inner, '%sif (rslt < 0) haveError = True;' % indent
 
                 self.genOffset(test, str(inner), level)
@@ -371,7 +879,9 @@ class Generate:
             print >> self.code, '%s// line %s' %(indent, test.lnum)
             if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-            print >> inner, '%srslt = regexMatch(buf, len, %s, &%s, %s, %s);' % (indent, targ, ovar, limit, flags)
+            print >> inner, '%srslt = regexMatch(%s, %s, &%s, %s, %s);' % \
+                                        (indent, self.bufArgs(test), targ, ovar, limit, flags)
+            self.putTrace(inner, test, indent)
             print >> inner, '%sif (rslt < 0) haveError = True;' % indent
 
             self.genOffset(test, str(inner), level)
@@ -391,7 +901,9 @@ class Generate:
             print >> self.code, '%s// line %s' %(indent, test.lnum)
             if RuntimeDebug: print >> self.code, "%s++testCount;" % indent
 
-            print >> inner, '%srslt = %s(buf, len, %s, %s, %s, &%s);' % (indent, func, value, compare, mask, ovar)
+            print >> inner, '%srslt = %s(%s, %s, %s, %s, &%s);' % \
+                                        (indent, func, self.bufArgs(test), value, compare, mask, ovar)
+            self.putTrace(inner, test, indent)
             print >> inner, '%sif (rslt < 0) haveError = True;' % indent
 
             self.genOffset(test, str(inner), level)
@@ -404,12 +916,50 @@ class Generate:
 
 
     def putTestBody(self, test, level):
-        # This is the common structure after each test
+        # This is the common structure after each test. A top-level
+        # test rarely passes.
+        indent = mkIndent(level)
+
+        if test.level == 0:
+            print >> self.code, '%sif (Unlikely(rslt > 0))' % indent
+        else:
+            print >> self.code, '%sif (rslt > 0)' % indent
+
+        print >> self.code, '%s{' % indent
+
+        if test.level == 0 and not test.setMime:
+            self.putColdContent(test, level + 1)
+        else:
+            self.putTestContent(test, level + 1)
+
+        print >> self.code, '%s}' % indent
+
+
+
+    def putColdContent(self, test, level):
+        # Write the subtests of a top-level test into coldTestN() if
+        # there are enough of them. It gets off0 and returns the result
+        # of the subtests.
         indent = mkIndent(level)
+        code   = self.code
+
+        self.code = OStream()
+        self.putTestContent(test, 1)
+        body = str(self.code)
+        self.code = code
 
+        if body.count('\n') < ColdLines:
+            self.code.write(utils.addIndent(body, level - 1))
+            return
+
+        n = len(self.coldTests)
+        self.coldTests.append("\n" + body)
+
+        print >> self.code, '%srslt = coldTest%d(buf, len, mime, off0, state);' % (indent, n)
+        print >> self.code, '%sif (rslt < 0) haveError = True;' % indent
         print >> self.code, '%sif (rslt > 0)' % indent
         print >> self.code, '%s{' % indent
-        self.putTestContent(test, level + 1)
+        print >> self.code, '%sreturn Match;' % mkIndent(level + 1)
         print >> self.code, '%s}' % indent
 
 
@@ -424,8 +974,11 @@ class Generate:
         indent = mkIndent(level)
 
         if test.setMime:
-            m = utils.quoteForC(test.setMime)
-            print >> self.code, '%s*mime = %s;' % (indent, m)
+            m = self.mimeRef(test.setMime)
+            (start, end) = self.matchRange(test)
+            print >> self.code, '%s*mime = %s;    // %s' % (indent, m, test.setMime)
+            print >> self.code, '%sif (Unlikely(state->match != NULL)) noteMatch(state, %s, %d, %s, %s);' % \
+                                        (indent, test.lnum, test.level, start, end)
             print >> self.code, '%sreturn Match;' % indent
 
         else:
@@ -434,6 +987,42 @@ class Generate:
 
 
 
+    def putTrace(self, out, test, indent, offset = None):
+        # Record the test in the trace ring, see traceTest(). The macro
+        # is empty unless the library is built with trace=yes. A test
+        # in the tail is inside a View so its offset is moved back.
+        if offset == None:
+            offset = mkOvar(test.level)
+            if self.inTail(test):
+                offset += ' + view.base'
+
+        print >> out, '%sTraceTest(%s, rslt, %s);' % (indent, test.lnum, offset)
+
+
+
+    def matchRange(self, test):
+        # The C expressions for the start and end of what a test that
+        # sets the MIME type matched, for noteMatch(). A test leaves its
+        # offset at the end and rslt is the length, except for these.
+        ovar = mkOvar(test.level)
+
+        if test.testCode == 'default' or test.targetOper == 'x':
+            # Nothing is read. It is where the test above left off.
+            at = mkOvar(test.level - 1) if test.level > 0 else '0'
+            return (at, at)
+
+        if test.testCode == 'string' and test.targetOper.endswith('!') and \
+                not test.testFlags and test.offset.simple:
+            # A !stringEqual() etc. from putSimpleString() doesn't move.
+            return (ovar, ovar)
+
+        if test.testCode == 'regex' and 's' in test.testFlags:
+            return (ovar, '%s + rslt' % ovar)
+
+        return ('%s - rslt' % ovar, ovar)
+
+
+
     def selectSimpleStringTests(self, tests):
         # Select simple string tests that have no flags but any non-indirect offset.
         # Further separate out the equality tests as they are the most useful to check first.
@@ -511,23 +1100,48 @@ class Generate:
         # Generate the code for the offset.  With indirection we need
         # something of the form: 
         #   rslt = getOffset(buf, len, off1, 's', &off1);
+        #   if (rslt > 0) rslt = offsetArith(&off1, '+', 30);
         #   if (rslt < 0) haveError = True;
-        #   else
+        #   else if (rslt > 0)
         #   {
-        #       off1 += (30);
         #       rslt = leShortMatch(buf, len, 0xcafe, CompareEq, 0xffffffff, off1);
         #       if (rslt < 0) haveError = True;
         #   }
 
         # For this we need the rest of the test passed in as a stream.
 
+        # A negative offset counts back from the end of the file. A test
+        # that may read the tail takes its buffer from a View:
+        #   rslt = endOffset(len, state, 22, &off0);
+        #   if (rslt > 0)
+        #   {
+        #       {
+        #           View view = fileView(buf, len, state, off0);
+        #
+        #           off0 -= view.base;
+        #           rslt = stringEqual(view.buf, view.len, ...);
+        #           if (rslt < 0) haveError = True;
+        #           off0 += view.base;
+        #       }
+        #   }
+
         indent = mkIndent(level)
+        ind1   = mkIndent(level + 1)
 
         off  = test.offset
         ovar = mkOvar(test.level)
+        rest = OStream()
 
-        # Start with a simple offset
-        print >> self.code,  "%s%s = %s;" % (indent, ovar, off.offset)
+        if self.inTail(test):
+            inner = OStream()
+            print >> inner, "%s{" % indent
+            print >> inner, "%sView view = fileView(buf, len, state, %s);" % (ind1, ovar)
+            print >> inner
+            print >> inner, "%s%s -= view.base;" % (ind1, ovar)
+            print >> inner, utils.addIndent(innerCode, 1),
+            print >> inner, "%s%s += view.base;" % (ind1, ovar)
+            print >> inner, "%s}" % indent
+            innerCode = str(inner)
 
         # It appears that (&0x7c.l+0x26) means *(0x7c + off) + 0x26
 
@@ -536,30 +1150,49 @@ class Generate:
 
             if off.innerRelative:
                 outer = mkOvar(test.level - 1)
-                print >> self.code, "%s%s += %s;" % (indent, ovar, outer)
+                print >> rest, "%s%s += %s;" % (indent, ovar, outer)
 
             # getOffset(const Byte* buf, size_t len, size_t at, char type, size_t* offset)
-            print >> self.code, "%srslt = getOffset(buf, len, %s, '%s', &%s);" % \
+            if self.readsTail(test):
+                print >> rest, "%s{" % indent
+                print >> rest, "%sView view = fileView(buf, len, state, %s);" % (ind1, ovar)
+                print >> rest
+                print >> rest, "%srslt = getOffset(view.buf, view.len, %s - view.base, '%s', &%s);" % \
+                                        (ind1, ovar, off.typeFlag, ovar)
+                print >> rest, "%s}" % indent
+            else:
+                print >> rest, "%srslt = getOffset(buf, len, %s, '%s', &%s);" % \
                                         (indent, ovar, off.typeFlag, ovar)
 
             if off.operand:
-                value = off.operand
-                print >> self.code, "%s%s %s= %s;" % (indent, ovar, off.operator, off.operand)
+                print >> rest, "%sif (rslt > 0) rslt = offsetArith(&%s, '%s', %s);" % \
+                                        (indent, ovar, off.operator, off.operand)
 
         if off.outerRelative:
             # Add the outer offset, for the direct and indirect cases
-            print >> self.code,  "%s%s += %s;" % (indent, ovar, mkOvar(test.level - 1))
+            print >> rest,  "%s%s += %s;" % (indent, ovar, mkOvar(test.level - 1))
 
         if off.indirect:
             # We have a rslt from above to 
-            print >> self.code, "%sif (rslt < 0) haveError = True;" % indent
-            print >> self.code, "%selse" % indent
-            print >> self.code, "%s{" % indent
+            print >> rest, "%sif (rslt < 0) haveError = True;" % indent
+            print >> rest, "%selse if (rslt > 0)" % indent
+            print >> rest, "%s{" % indent
             innerCode = utils.addIndent(innerCode, 1)
-            print >> self.code, innerCode,
+            print >> rest, innerCode,
+            print >> rest, "%s}" % indent
+        else:
+            print >> rest, innerCode,
+
+        if self.fromEnd(off):
+            print >> self.code, "%srslt = endOffset(len, state, %s, &%s);" % (indent, off.offset[1:], ovar)
+            print >> self.code, "%sif (rslt > 0)" % indent
+            print >> self.code, "%s{" % indent
+            print >> self.code, utils.addIndent(str(rest), 1),
             print >> self.code, "%s}" % indent
         else:
-            print >> self.code, innerCode,
+            # Start with a simple offset
+            print >> self.code,  "%s%s = %s;" % (indent, ovar, off.offset)
+            print >> self.code, str(rest),
 
 
 
@@ -567,21 +1200,166 @@ class Generate:
         out = open(path, "w")
 
         utils.copyFile(PrologueFile, out)
+        self.putMimeNames(out)
         out.write(str(self.data))
 
         if RuntimeDebug:
             print >> out, "static size_t testCount;"
 
+        print >> out, "\nstatic Result indirectMatch(const Byte* buf, size_t len, size_t offset, MimeId* mime,"
+        print >> out, "                            const SegmentState* state);"
+
+        # These don't need off0, it's an argument.
+        for (n, code) in enumerate(self.coldTests):
+            self.putFunction(out,
+                "coldTest%d(const Byte* buf, size_t len, MimeId* mime, size_t off0, SegmentState* state)" % n,
+                code, "Cold ", 1)
+
+        for (n, code) in enumerate(self.farTests):
+            self.putFunction(out,
+                "farTest%d(const Byte* buf, size_t len, MimeId* mime, SegmentState* state)" % n, code)
+
+        self.putRunDeferred(out)
+
+        for (n, code) in enumerate(self.segments):
+            self.putFunction(out,
+                "runSegment%d(const Byte* buf, size_t len, MimeId* mime, SegmentState* state)" % n,
+                code)
+
+        print >> out, "#define SegmentCount %d\n" % len(self.segments)
+        print >> out, "static const Segment segments[SegmentCount] = {"
+        for n in range(len(self.segments)):
+            print >> out, "%srunSegment%d," % (mkIndent(1), n)
+        print >> out, "};"
+
         print >> out, """
+
+/*  Run the segments in turn. The first match is the same as from
+    running the whole tree in one function.
+*/
+static Result
+runTests(const Byte* buf, size_t len, MimeId* mime, int flags, int depth, const Tail* tail,
+         MimeMagicMatch* match)
+{
+    SegmentState state = {0, flags, 0, depth, tail, match};
+    Bool    haveError = False;
+    Result  rslt;
+    int     i;
+
+    for (i = 0; i < SegmentCount; ++i)
+    {
+        rslt = segments[i](buf, len, mime, &state);
+
+        if (rslt > 0)
+        {
+            return Match;
+        }
+
+        if (rslt < 0)
+        {
+            haveError = True;
+        }
+    }
+
+    if (state.deferred)
+    {
+        rslt = runDeferred(buf, len, mime, &state);
+
+        if (rslt > 0)
+        {
+            return Match;
+        }
+
+        if (rslt < 0)
+        {
+            haveError = True;
+        }
+    }
+
+    if (haveError)
+    {
+        // nothing matched, perhaps because of the error
+        return Error;
+    }
+    return Fail;
+}
+
+
+
+/*  An indirect test runs the whole tree from its offset, but not the
+    text check. Past MaxIndirect levels it just fails. The positions of
+    the tail count from the offset too, and those of a match are moved
+    back to the buffer.
+*/
 static Result
-runTests(const Byte* buf, size_t len, const char** mime)
+indirectMatch(const Byte* buf, size_t len, size_t offset, MimeId* mime, const SegmentState* state)
+{
+    const Tail* tail = state->tail;
+    Tail        inner;
+    Result      rslt;
+
+    if (offset >= len)
+    {
+        return Error;
+    }
+
+    if (state->depth >= MaxIndirect)
+    {
+        return Fail;
+    }
+
+    if (tail)
+    {
+        size_t start = tail->size - tail->len;
+        size_t cut   = offset > start? offset - start : 0;
+
+        inner.buf  = tail->buf + cut;
+        inner.len  = tail->len - cut;
+        inner.size = tail->size - offset;
+        tail = &inner;
+    }
+
+    rslt = runTests(buf + offset, len - offset, mime, state->flags, state->depth + 1, tail, state->match);
+
+    if (rslt > 0 && state->match)
+    {
+        state->match->start += offset;
+        state->match->end   += offset;
+    }
+
+    return rslt;
+}
+
+"""
+        self.putCarveTables(out)
+
+        for f in SupportFiles:
+            utils.copyFile(f, out)
+
+        utils.copyFile(EpilogueFile, out)
+        out.close()
+
+
+
+    def putFunction(self, out, header, code, attrs = "", first = 0):
+        # A function of tests with the usual result. We need an 'offN'
+        # variable for each level of nesting that the code uses, from
+        # first. They start at zero in each function.
+        code  = str(code)
+        used  = set([int(n) for n in re.findall(r'\boff(\d+)\b', code)])
+        decl  = ['off%d = 0' % n for n in sorted(used) if n >= first]
+
+        print >> out, """
+static %sResult
+%s
 {
     Result rslt;
     Bool   haveError = False;
-""",
+""" % (attrs, header),
 
-        out.write(str(self.decls))
-        out.write(str(self.code))
+        if decl:
+            print >> out, "%ssize_t %s;" % (mkIndent(1), ', '.join(decl))
+        out.write(code)
 
         print >> out, """
 
@@ -594,5 +1372,40 @@ runTests(const Byte* buf, size_t len, const char** mime)
 }
 
 """
-        utils.copyFile(EpilogueFile, out)
-        out.close()
+
+
+
+    def putRunDeferred(self, out):
+        # Run the far tests that were put off, in their original order.
+        ind1 = mkIndent(1)
+        ind2 = mkIndent(2)
+        ind3 = mkIndent(3)
+
+        print >> out, """
+/*  Run the far tests that deferFar() put off. This is only called when
+    nothing else matched so a match here is the one the default order
+    would give.
+*/
+static Result
+runDeferred(const Byte* buf, size_t len, MimeId* mime, SegmentState* state)
+{
+    Result rslt;
+    Bool   haveError = False;
+"""
+
+        for n in range(len(self.farTests)):
+            print >> out, "%sif (state->deferred & ((uint32_t)1 << %d))" % (ind1, n)
+            print >> out, "%s{" % ind1
+            print >> out, "%srslt = farTest%d(buf, len, mime, state);" % (ind2, n)
+            print >> out, "%sif (rslt < 0) haveError = True;" % ind2
+            print >> out, "%sif (rslt > 0)" % ind2
+            print >> out, "%s{" % ind2
+            print >> out, "%sreturn Match;" % ind3
+            print >> out, "%s}" % ind2
+            print >> out, "%s}" % ind1
+            print >> out
+
+        print >> out, """%sreturn haveError? Error : Fail;
+}
+
+""" % ind1
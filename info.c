@@ -0,0 +1,334 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  Basic metadata for getMimeTypeInfo(), read from the headers that the
+    tests for the format have just looked at, so they are in the cache.
+    Each reader checks its bounds and leaves a field at 0 if the header
+    isn't all there. Nothing is searched for past the first chunks.
+*/
+
+//======================================================================
+
+static inline uint32_t
+infoBe16(const Byte* p)
+{
+    return p[0] << 8 | p[1];
+}
+
+
+
+static inline uint32_t
+infoBe32(const Byte* p)
+{
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+
+
+static inline uint32_t
+infoLe16(const Byte* p)
+{
+    return p[0] | p[1] << 8;
+}
+
+
+
+static inline uint32_t
+infoLe32(const Byte* p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+
+
+static void
+pngInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    /*  IHDR is the first chunk. An animated PNG has an acTL chunk with
+        the number of frames before the first IDAT.
+    */
+    static const Byte Channels[] = {1, 0, 3, 1, 2, 0, 4};
+    size_t pos;
+
+    if (len < 33 || memcmp(buf + 12, "IHDR", 4) != 0)
+    {
+        return;
+    }
+
+    info->width  = infoBe32(buf + 16);
+    info->height = infoBe32(buf + 20);
+
+    if (buf[25] < sizeof(Channels))
+    {
+        info->depth = buf[24] * Channels[buf[25]];
+    }
+
+    for (pos = 33; pos + 12 <= len; pos += infoBe32(buf + pos) + 12)
+    {
+        const Byte* type = buf + pos + 4;
+
+        if (memcmp(type, "IDAT", 4) == 0 || infoBe32(buf + pos) > len)
+        {
+            break;
+        }
+
+        if (memcmp(type, "acTL", 4) == 0)
+        {
+            info->frames = infoBe32(buf + pos + 8);
+            break;
+        }
+    }
+}
+
+
+
+static void
+mngInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    // MHDR has the frame count and the play time in ticks.
+    uint32_t ticks;
+
+    if (len < 40 || memcmp(buf + 12, "MHDR", 4) != 0)
+    {
+        return;
+    }
+
+    info->width  = infoBe32(buf + 16);
+    info->height = infoBe32(buf + 20);
+    info->frames = infoBe32(buf + 32);
+    ticks        = infoBe32(buf + 24);
+
+    if (ticks > 0)
+    {
+        info->milliseconds = (uint64_t)infoBe32(buf + 36) * 1000 / ticks;
+    }
+}
+
+
+
+static void
+gifInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    // The logical screen descriptor. Counting frames needs the whole file.
+    if (len < 11)
+    {
+        return;
+    }
+
+    info->width  = infoLe16(buf + 6);
+    info->height = infoLe16(buf + 8);
+    info->depth  = (buf[10] & 7) + 1;
+}
+
+
+
+static void
+jpegInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    /*  Skip the segments up to the first start of frame, SOF0 to SOF15
+        except for DHT, JPG and DAC that share the range.
+    */
+    size_t pos = 2;
+
+    while (pos + 4 <= len && buf[pos] == 0xFF)
+    {
+        Byte marker = buf[pos + 1];
+
+        if (marker == 0xFF)
+        {
+            ++pos;
+            continue;
+        }
+
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+        {
+            if (pos + 10 <= len)
+            {
+                info->height = infoBe16(buf + pos + 5);
+                info->width  = infoBe16(buf + pos + 7);
+                info->depth  = buf[pos + 4] * buf[pos + 9];
+            }
+            return;
+        }
+
+        if (marker == 0xDA)
+        {
+            return;
+        }
+
+        pos += 2 + infoBe16(buf + pos + 2);
+    }
+}
+
+
+
+static void
+bmpInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    // An OS/2 header has 16 bit fields. The height is negative top down.
+    int32_t height;
+
+    if (len < 26)
+    {
+        return;
+    }
+
+    if (infoLe32(buf + 14) == 12)
+    {
+        info->width  = infoLe16(buf + 18);
+        info->height = infoLe16(buf + 20);
+        info->depth  = infoLe16(buf + 24);
+        return;
+    }
+
+    if (len < 30)
+    {
+        return;
+    }
+
+    height       = (int32_t)infoLe32(buf + 22);
+    info->width  = infoLe32(buf + 18);
+    info->height = height < 0? -(uint32_t)height : (uint32_t)height;
+    info->depth  = infoLe16(buf + 28);
+}
+
+
+
+static void
+webpInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    // The first chunk is a lossy or lossless bitstream or the extended header.
+    if (len < 30)
+    {
+        return;
+    }
+
+    if (memcmp(buf + 12, "VP8 ", 4) == 0 && memcmp(buf + 23, "\x9d\x01\x2a", 3) == 0)
+    {
+        info->width  = infoLe16(buf + 26) & 0x3FFF;
+        info->height = infoLe16(buf + 28) & 0x3FFF;
+        info->depth  = 24;
+    }
+    else
+    if (memcmp(buf + 12, "VP8L", 4) == 0 && buf[20] == 0x2F)
+    {
+        uint32_t bits = infoLe32(buf + 21);
+
+        info->width  = (bits & 0x3FFF) + 1;
+        info->height = (bits >> 14 & 0x3FFF) + 1;
+        info->depth  = bits >> 28 & 1? 32 : 24;
+    }
+    else
+    if (memcmp(buf + 12, "VP8X", 4) == 0)
+    {
+        info->width  = (infoLe32(buf + 24) & 0xFFFFFF) + 1;
+        info->height = (infoLe32(buf + 26) >> 8) + 1;
+        info->depth  = buf[20] & 0x10? 32 : 24;
+    }
+}
+
+
+
+static void
+wavInfo(const Byte* buf, size_t len, MimeMagicInfo* info)
+{
+    /*  The duration is the size of the data chunk over the byte rate in
+        the fmt chunk. The chunks are walked as far as the buffer goes.
+    */
+    uint32_t    rate = 0;
+    size_t      pos;
+
+    for (pos = 12; pos + 8 <= len; pos += 8 + ((infoLe32(buf + pos + 4) + 1) & ~1u))
+    {
+        uint32_t size = infoLe32(buf + pos + 4);
+
+        if (memcmp(buf + pos, "fmt ", 4) == 0 && pos + 24 <= len)
+        {
+            info->depth = infoLe16(buf + pos + 22);
+            rate        = infoLe32(buf + pos + 16);
+        }
+        else
+        if (memcmp(buf + pos, "data", 4) == 0)
+        {
+            if (rate > 0)
+            {
+                info->milliseconds = (uint64_t)size * 1000 / rate;
+            }
+            break;
+        }
+
+        if (size > len)
+        {
+            break;
+        }
+    }
+}
+
+
+
+int
+getMimeTypeInfo(const Byte* buf, size_t len, const char** mime, MimeMagicInfo* info, int flags)
+{
+    unsigned int    id;
+    int             r = getMimeId(buf, len, &id, flags);
+
+    memset(info, 0, sizeof(*info));
+    *mime = mimeNames[id];
+
+    switch (id)
+    {
+    case MimeMagic_image_png:
+        pngInfo(buf, len, info);
+        break;
+
+    case MimeMagic_video_x_mng:
+        mngInfo(buf, len, info);
+        break;
+
+    case MimeMagic_image_gif:
+        gifInfo(buf, len, info);
+        break;
+
+    case MimeMagic_image_jpeg:
+        jpegInfo(buf, len, info);
+        break;
+
+    case MimeMagic_image_x_ms_bmp:
+    case MimeMagic_image_bmp:
+        bmpInfo(buf, len, info);
+        break;
+
+    case MimeMagic_image_webp:
+        webpInfo(buf, len, info);
+        break;
+
+    case MimeMagic_audio_x_wav:
+        wavInfo(buf, len, info);
+        break;
+    }
+
+    return r;
+}
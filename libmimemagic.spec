@@ -0,0 +1,57 @@
+Summary: Mime Magic Library
+Name: libmimemagic
+Version: 0.2
+Release: 2
+License: See LICENSE
+Group: Development/Libraries
+URL: http://somewhere.com/libmimemagic-%{version}.tgz
+Packager: Anthony Shipman
+
+Prefix: /usr
+Source0: libmimemagic-%{version}.tgz
+BuildRoot: %{_topdir}/buildroot
+
+%description 
+This library recognises the MIME type for the data in a buffer.
+It is based on libmagic as used by the file command.
+
+%prep
+%setup
+
+
+%build
+./configure --prefix=%{_prefix} --docdir=%{_defaultdocdir}
+make
+
+
+%install
+rm -rf $RPM_BUILD_ROOT
+mkdir -p $RPM_BUILD_ROOT
+make DEST_DIR=$RPM_BUILD_ROOT/ install
+
+install -d $RPM_BUILD_ROOT/%{_libdir}/pkgconfig/
+install libmimemagic.pc $RPM_BUILD_ROOT/%{_libdir}/pkgconfig/
+
+gzip -c mimemagic.man > mimemagic.3.gz
+install -d $RPM_BUILD_ROOT/%{_mandir}/man3
+install mimemagic.3.gz $RPM_BUILD_ROOT/%{_mandir}/man3
+
+install -d $RPM_BUILD_ROOT/%{_defaultdocdir}/libmimemagic
+install LICENSE README.md README.html $RPM_BUILD_ROOT/%{_defaultdocdir}/libmimemagic
+
+
+%clean
+rm -rf $RPM_BUILD_ROOT
+
+
+%files
+%defattr(-,root,root)
+%{_libdir}/libmimemagic.*
+%{_libdir}/pkgconfig/libmimemagic.pc
+%{_includedir}/mimemagic.h
+%{_includedir}/mimemagic.hpp
+%{_includedir}/mimemagic_ids.h
+%{_includedir}/mimemagicd.h
+%{_bindir}/mimemagicd
+%{_mandir}/man3/mimemagic.3.gz
+%{_defaultdocdir}/libmimemagic
@@ -40,6 +40,13 @@ enum MimeMagicFlags
     /* Don't try to recognise text/plain with ASCII or Unicode character sets.
     */
     MimeMagicNoTryText = 1 << 0,
+
+    /* For a memory-mapped file. Put off the few tests far into the
+       buffer whose pages aren't resident until nothing else matches.
+       A far test then can't win over a later test that also matches,
+       so the result can differ from the default order.
+    */
+    MimeMagicDeferFaults = 1 << 1,
 };
 
 
@@ -50,7 +57,9 @@ enum MimeMagicFlags
     If no match was found then 0 is returned.
 
     If no match was found and it appears that a larger chunk of data
-    might help then -1 is returned.
+    might help then -1 is returned. This is only when a test ran off the
+    end of the buffer, or the data might pass as text with more of it.
+    A search that saw all of its window and failed is not an error.
 
 */
 
@@ -68,7 +77,10 @@ getMimeType(
     character sets recognised at the moment are ASCII and UTF-8.
 
     This is the step that would be omitted by getMimeType() when the
-    MimeMagicNoTryText flag is set.
+    MimeMagicNoTryText flag is set. It returns 0 if the data can't be
+    text, because of a NUL or a byte sequence that isn't UTF-8, and -1
+    if it has too many control characters, as more data would allow
+    more of them.
 
     The flags argument is currently ignored.
 */
@@ -80,6 +92,327 @@ tryPlainText(
     int             flags
     );
 
+/*  This is like getMimeType() except that it sets *id to a number for
+    the MIME type instead of a string. The ids are listed in the
+    generated header mimemagic_ids.h. On failure *id is set to 0.
+    Comparing ids is cheaper than comparing strings.
+*/
+extern int
+getMimeId(
+    const unsigned char* buf,
+    size_t          len,
+    unsigned int*   id,
+    int             flags
+    );
+
+
+/*  This returns the MIME string for an id from getMimeId(). It returns
+    NULL for 0 or an unknown id. The string is a constant.
+*/
+extern const char*
+mimeMagicName(unsigned int id);
+
+//======================================================================
+
+/*  A thread pool supplied by the caller for getMimeTypeParallel().
+
+    submit() must arrange for fn(arg) to be called once, normally on
+    another thread, and return 0. It returns non-zero if it can't, and
+    the caller does the work itself. At most threads tasks are submitted
+    for each call, so this is usually the number of idle workers.
+*/
+typedef struct MimeMagicExecutor
+{
+    int   (*submit)(void* context, void (*fn)(void* arg), void* arg);
+    void*   context;
+    int     threads;
+} MimeMagicExecutor;
+
+
+enum
+{
+    /*  The default size of buffer for getMimeTypeParallel().
+    */
+    MimeMagicParallelThreshold = 1 << 16,
+};
+
+
+/*  This is like getMimeType() and gives the same result. When the
+    buffer has at least threshold bytes and the cheap tests find nothing,
+    the expensive searches and regular expressions are run concurrently
+    on the executor. Those that can no longer give the first match are
+    cancelled early.
+
+    With a NULL executor or a smaller buffer it is just getMimeType(). A
+    threshold of 0 means MimeMagicParallelThreshold. The call waits only
+    for the tasks that it submitted that have started. One that starts
+    after the call has run out of work returns at once, so it may be
+    made from a worker of the same pool, even a pool of one.
+*/
+extern int
+getMimeTypeParallel(
+    const unsigned char* buf,
+    size_t          len,
+    const char**    mime,
+    int             flags,
+    const MimeMagicExecutor* executor,
+    size_t          threshold
+    );
+
+/*  This is like getMimeType() for a large file when only its head and
+    its tail are at hand. size is the length of the whole file and the
+    tail is its last tailLen bytes. The tail may be NULL with tailLen 0.
+
+    The rules at negative offsets count back from the end of the file and
+    read the tail, as do the rules that follow on from them, such as the
+    central directory of a Zip archive. The rest read the head. A rule
+    that needs the bytes between the two gives -1 as for a short buffer.
+    With getMimeType() the end of the buffer is taken as the end of the
+    file.
+*/
+extern int
+getMimeTypeHeadTail(
+    const unsigned char* head,
+    size_t          headLen,
+    const unsigned char* tail,
+    size_t          tailLen,
+    size_t          size,
+    const char**    mime,
+    int             flags
+    );
+
+/*  This classifies count buffers, setting mimes[i] and results[i] as
+    getMimeType() would for each. It is a convenience for callers with
+    an array of objects and is no faster than a loop.
+*/
+extern void
+getMimeTypeBatch(
+    const unsigned char* const* bufs,
+    const size_t*   lens,
+    size_t          count,
+    const char**    mimes,
+    int*            results,
+    int             flags
+    );
+
+/*  This is like getMimeType() for base64 text, such as an email
+    attachment or a data: URI, in the standard or the URL-safe alphabet
+    with or without line breaks. A data: URI without ;base64 before the
+    comma has its payload %-escaped instead. Only as much of the text is
+    decoded as the tests need, at most a few tens of KB. It returns 0 if
+    the text isn't base64. Until all of it is decoded the end of the
+    file isn't known, so the rules that read the end give -1.
+*/
+extern int
+getMimeTypeBase64(
+    const char*     text,
+    size_t          len,
+    const char**    mime,
+    int             flags
+    );
+
+/*  The metadata from getMimeTypeInfo(). A field is 0 if it is unknown.
+*/
+typedef struct MimeMagicInfo
+{
+    unsigned int    width;          // in pixels
+    unsigned int    height;
+    unsigned int    depth;          // bits per pixel or per audio sample
+    unsigned int    frames;         // of an animation
+    unsigned long long milliseconds; // of play time
+} MimeMagicInfo;
+
+
+/*  This is like getMimeType() and also fills in *info from the headers
+    of a few formats, those that the tests have just read. They are PNG,
+    MNG, GIF, JPEG, BMP, WebP and WAV. The frames of a GIF and the pages
+    of a PDF would need the whole file so they aren't counted.
+*/
+extern int
+getMimeTypeInfo(
+    const unsigned char* buf,
+    size_t          len,
+    const char**    mime,
+    MimeMagicInfo*  info,
+    int             flags
+    );
+
+/*  Where the MIME type from getMimeTypeMatch() came from. line is that
+    of the rule in the magic file that set it and depth is its level,
+    0 for a top-level rule. start and end bound the bytes that its test
+    matched, so a parser can carry on from end. A rule that always
+    matches has start and end where the rule above it left off.
+
+    For the text check line is 0 and the range is the whole buffer.
+*/
+typedef struct MimeMagicMatch
+{
+    unsigned int    line;
+    unsigned int    depth;
+    size_t          start;
+    size_t          end;
+} MimeMagicMatch;
+
+
+/*  This is like getMimeType() and also fills in *match when a MIME type
+    is found. Otherwise it is all 0.
+*/
+extern int
+getMimeTypeMatch(
+    const unsigned char* buf,
+    size_t          len,
+    const char**    mime,
+    MimeMagicMatch* match,
+    int             flags
+    );
+
+/*  A callback for mimeMagicCarve(). It returns non-zero to stop the scan.
+*/
+typedef int (*MimeMagicCarveFn)(void* context, size_t offset, const char* mime);
+
+
+/*  This finds where known formats start anywhere in the buffer, such as
+    the files in a disk image. For each one it calls found() with the
+    offset and the MIME type, in order of offset. It returns the number
+    found.
+
+    Only the formats with a magic number or a search string of at least
+    4 bytes within 15 bytes of their start are looked for. A candidate
+    is confirmed by the tests that could give its MIME type, from where
+    the file would start, without the text check. A text magic number
+    only counts at the start of the buffer or after a byte that isn't
+    text.
+
+    On one core with AVX2 it scans 1 to 5GB/s, depending on how much
+    of the buffer could hold a magic number, and 500 to 800MB/s
+    without. Text files and formats whose magic number is short,
+    case-folded or further in, such as JPEG, MP3 and tar, are not found.
+*/
+extern size_t
+mimeMagicCarve(
+    const unsigned char* buf,
+    size_t          len,
+    MimeMagicCarveFn found,
+    void*           context
+    );
+
+//======================================================================
+
+/*  One test in a trace from getMimeTypeTraced().
+*/
+typedef struct MimeMagicTraceEntry
+{
+    unsigned int    line;       // of the test in the magic file, 0 for the text check
+    int             result;     // 1 matched, 0 failed, -1 ran out of data
+    size_t          offset;     // where the test left off
+    unsigned long long cycles;  // when it finished, from the CPU's time stamp counter
+} MimeMagicTraceEntry;
+
+
+/*  A ring of size entries supplied by the caller. count is the number
+    of tests that ran. The last of them, up to size, are in the ring
+    with the latest at (count - 1) % size. start is the time of the
+    call, so the time of a test is from the entry before it.
+*/
+typedef struct MimeMagicTrace
+{
+    MimeMagicTraceEntry* entries;
+    size_t          size;
+    size_t          count;
+    unsigned long long start;
+} MimeMagicTrace;
+
+
+/*  This is like getMimeType() and records each test that it runs, in
+    order, with its outcome and when it finished. The tests run by an
+    indirect test are included. This is for finding which searches or
+    regular expressions make an input slow.
+
+    The tests are only recorded if the library was built with tracing
+    (make trace=yes). Otherwise count is left at 0 and the normal build
+    has no trace code at all.
+*/
+extern int
+getMimeTypeTraced(
+    const unsigned char* buf,
+    size_t          len,
+    const char**    mime,
+    int             flags,
+    MimeMagicTrace* trace
+    );
+
+//======================================================================
+
+enum
+{
+    /*  The default and the largest number of bytes of each input kept by
+        mimeMagicSampleStart().
+    */
+    MimeMagicSampleBytes    = 1 << 12,
+    MimeMagicSampleMaxBytes = 1 << 16,
+};
+
+
+/*  The file written by mimeMagicSampleStart() starts with the 8 bytes
+    "MMSAMPL1". Then for each sample there is a MimeMagicSample, mimeLen
+    bytes of the MIME type, without a NUL, and bytes of the input. The
+    numbers are in the byte order of the host.
+*/
+typedef struct MimeMagicSample
+{
+    unsigned long long length;      // of the whole input
+    unsigned long long nanoseconds; // spent in the call
+    int             result;         // as returned
+    int             flags;          // as passed
+    unsigned int    mimeLen;        // of the MIME type that follows, 0 if none
+    unsigned int    bytes;          // of the input that follow the MIME type
+} MimeMagicSample;
+
+
+/*  If the library was built with sampling (make sample=yes) then this
+    starts recording about one in rate calls to getMimeType() and the
+    other functions, with the first bytes of each input, at most
+    MimeMagicSampleMaxBytes. A bytes of 0 means MimeMagicSampleBytes.
+
+    A sample is kept in a ring private to the calling thread and a
+    background thread appends them to the file at path every 100ms. A
+    call that isn't sampled costs about a nanosecond. A ring holds 64
+    samples so a thread can keep a few hundred a second. Beyond that,
+    samples are dropped rather than make the calls wait.
+
+    It returns 0 on success. It returns -1 if sampling is already running,
+    the file can't be opened or the library was built without sampling.
+*/
+extern int
+mimeMagicSampleStart(const char* path, unsigned int rate, size_t bytes);
+
+
+/*  This stops sampling, writes out the samples still in the rings and
+    closes the file. It returns the number of samples that were dropped.
+*/
+extern unsigned long long
+mimeMagicSampleStop(void);
+
+//======================================================================
+
+enum MimeMagicStatsFormat
+{
+    MimeMagicStatsPrometheus = 0,
+    MimeMagicStatsJSON       = 1,
+};
+
+
+/*  If the library was built with statistics (make stats=yes) then
+    each call to getMimeType() records its latency by outcome and by
+    the MIME type found.  This merges the counts from all threads and
+    renders them in the given format.
+
+    The result must be freed by the caller with free(). NULL is returned
+    if the library was built without statistics.
+*/
+extern char*
+mimeMagicStatsSnapshot(int format);
+
 //======================================================================
 
 #ifdef __cplusplus
@@ -0,0 +1,125 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+#ifndef MIME_MAGIC_HPP
+#define MIME_MAGIC_HPP
+
+/*  A C++ interface to the library. It is only inline wrappers over the
+    C functions. Nothing is allocated and the results are ids that
+    compare as integers. The id constants, such as
+    mimemagic::id::application_pdf, are in mimemagic_ids.h.
+
+    This needs C++17. The std::span overloads need C++20.
+*/
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "mimemagic.h"
+#include "mimemagic_ids.h"
+
+namespace mimemagic
+{
+
+//======================================================================
+
+using MimeId = ::MimeMagicId;
+
+enum Flags : int
+{
+    None        = MimeMagicNone,
+    NoTryText   = MimeMagicNoTryText,
+    DeferFaults = MimeMagicDeferFaults,
+};
+
+
+
+/*  The id of the MIME type of the data, or nullopt if it wasn't
+    recognised.
+*/
+inline std::optional<MimeId>
+detect(const void* data, std::size_t len, int flags = None) noexcept
+{
+    unsigned int id;
+
+    if (getMimeId(static_cast<const unsigned char*>(data), len, &id, flags) > 0)
+    {
+        return static_cast<MimeId>(id);
+    }
+
+    return std::nullopt;
+}
+
+
+
+inline std::optional<MimeId>
+detect(std::string_view data, int flags = None) noexcept
+{
+    return detect(data.data(), data.size(), flags);
+}
+
+
+
+#if __cplusplus >= 202002L
+
+inline std::optional<MimeId>
+detect(std::span<const std::byte> data, int flags = None) noexcept
+{
+    return detect(data.data(), data.size(), flags);
+}
+
+
+
+inline std::optional<MimeId>
+detect(std::span<const unsigned char> data, int flags = None) noexcept
+{
+    return detect(data.data(), data.size(), flags);
+}
+
+#endif
+
+
+
+/*  The MIME string of an id. It is empty for MimeMagicIdNone.
+*/
+inline std::string_view
+name(MimeId id) noexcept
+{
+    const char* n = mimeMagicName(id);
+
+    return n ? std::string_view(n) : std::string_view();
+}
+
+//======================================================================
+
+} // namespace mimemagic
+
+#endif // MIME_MAGIC_HPP
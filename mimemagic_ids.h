@@ -0,0 +1,424 @@
+/*  This file is generated by compile.py. Don't edit it.
+
+    These are the ids of the MIME types that getMimeId() returns. They
+    change when the magic file changes so they should only be used with
+    the library that was built with this header and not stored.
+*/
+
+#ifndef MIME_MAGIC_IDS_HH
+#define MIME_MAGIC_IDS_HH
+
+enum MimeMagicId
+{
+    MimeMagicIdNone = 0,
+    MimeMagic_text_plain_charset_US_ASCII = 1,    // text/plain; charset=US-ASCII
+    MimeMagic_text_plain_charset_UTF_8 = 2,    // text/plain; charset=UTF-8
+    MimeMagic_text_plain_charset_UTF_16 = 3,    // text/plain; charset=UTF-16
+    MimeMagic_application_dicom = 4,    // application/dicom
+    MimeMagic_application_epub_zip = 5,    // application/epub+zip
+    MimeMagic_application_java_archive = 6,    // application/java-archive
+    MimeMagic_application_javascript = 7,    // application/javascript
+    MimeMagic_application_msword = 8,    // application/msword
+    MimeMagic_application_octet_stream = 9,    // application/octet-stream
+    MimeMagic_application_ogg = 10,    // application/ogg
+    MimeMagic_application_pdf = 11,    // application/pdf
+    MimeMagic_application_pgp = 12,    // application/pgp
+    MimeMagic_application_pgp_keys = 13,    // application/pgp-keys
+    MimeMagic_application_pgp_signature = 14,    // application/pgp-signature
+    MimeMagic_application_postscript = 15,    // application/postscript
+    MimeMagic_application_unknown_zip = 16,    // application/unknown+zip
+    MimeMagic_application_vnd_cups_raster = 17,    // application/vnd.cups-raster
+    MimeMagic_application_vnd_debian_binary_package = 18,    // application/vnd.debian.binary-package
+    MimeMagic_application_vnd_fdf = 19,    // application/vnd.fdf
+    MimeMagic_application_vnd_google_earth_kml_xml = 20,    // application/vnd.google-earth.kml+xml
+    MimeMagic_application_vnd_google_earth_kmz = 21,    // application/vnd.google-earth.kmz
+    MimeMagic_application_vnd_ms_cab_compressed = 22,    // application/vnd.ms-cab-compressed
+    MimeMagic_application_vnd_ms_excel = 23,    // application/vnd.ms-excel
+    MimeMagic_application_vnd_ms_fontobject = 24,    // application/vnd.ms-fontobject
+    MimeMagic_application_vnd_ms_opentype = 25,    // application/vnd.ms-opentype
+    MimeMagic_application_vnd_oasis_opendocument_chart = 26,    // application/vnd.oasis.opendocument.chart
+    MimeMagic_application_vnd_oasis_opendocument_chart_template = 27,    // application/vnd.oasis.opendocument.chart-template
+    MimeMagic_application_vnd_oasis_opendocument_database = 28,    // application/vnd.oasis.opendocument.database
+    MimeMagic_application_vnd_oasis_opendocument_formula = 29,    // application/vnd.oasis.opendocument.formula
+    MimeMagic_application_vnd_oasis_opendocument_formula_template = 30,    // application/vnd.oasis.opendocument.formula-template
+    MimeMagic_application_vnd_oasis_opendocument_graphics = 31,    // application/vnd.oasis.opendocument.graphics
+    MimeMagic_application_vnd_oasis_opendocument_graphics_template = 32,    // application/vnd.oasis.opendocument.graphics-template
+    MimeMagic_application_vnd_oasis_opendocument_image = 33,    // application/vnd.oasis.opendocument.image
+    MimeMagic_application_vnd_oasis_opendocument_image_template = 34,    // application/vnd.oasis.opendocument.image-template
+    MimeMagic_application_vnd_oasis_opendocument_presentation = 35,    // application/vnd.oasis.opendocument.presentation
+    MimeMagic_application_vnd_oasis_opendocument_presentation_template = 36,    // application/vnd.oasis.opendocument.presentation-template
+    MimeMagic_application_vnd_oasis_opendocument_spreadsheet = 37,    // application/vnd.oasis.opendocument.spreadsheet
+    MimeMagic_application_vnd_oasis_opendocument_spreadsheet_template = 38,    // application/vnd.oasis.opendocument.spreadsheet-template
+    MimeMagic_application_vnd_oasis_opendocument_text = 39,    // application/vnd.oasis.opendocument.text
+    MimeMagic_application_vnd_oasis_opendocument_text_master = 40,    // application/vnd.oasis.opendocument.text-master
+    MimeMagic_application_vnd_oasis_opendocument_text_template = 41,    // application/vnd.oasis.opendocument.text-template
+    MimeMagic_application_vnd_oasis_opendocument_text_web = 42,    // application/vnd.oasis.opendocument.text-web
+    MimeMagic_application_vnd_openxmlformats_officedocument_presentationml_presentation = 43,    // application/vnd.openxmlformats-officedocument.presentationml.presentation
+    MimeMagic_application_vnd_openxmlformats_officedocument_spreadsheetml_sheet = 44,    // application/vnd.openxmlformats-officedocument.spreadsheetml.sheet
+    MimeMagic_application_vnd_openxmlformats_officedocument_wordprocessingml_document = 45,    // application/vnd.openxmlformats-officedocument.wordprocessingml.document
+    MimeMagic_application_vnd_rn_realmedia = 46,    // application/vnd.rn-realmedia
+    MimeMagic_application_x_7z_compressed = 47,    // application/x-7z-compressed
+    MimeMagic_application_x_abook_addressbook = 48,    // application/x-abook-addressbook
+    MimeMagic_application_x_bittorrent = 49,    // application/x-bittorrent
+    MimeMagic_application_x_bzip2 = 50,    // application/x-bzip2
+    MimeMagic_application_x_coredump = 51,    // application/x-coredump
+    MimeMagic_application_x_dbf = 52,    // application/x-dbf
+    MimeMagic_application_x_dvi = 53,    // application/x-dvi
+    MimeMagic_application_x_eet = 54,    // application/x-eet
+    MimeMagic_application_x_epoc_agenda = 55,    // application/x-epoc-agenda
+    MimeMagic_application_x_epoc_app = 56,    // application/x-epoc-app
+    MimeMagic_application_x_epoc_data = 57,    // application/x-epoc-data
+    MimeMagic_application_x_epoc_jotter = 58,    // application/x-epoc-jotter
+    MimeMagic_application_x_epoc_opl = 59,    // application/x-epoc-opl
+    MimeMagic_application_x_epoc_opo = 60,    // application/x-epoc-opo
+    MimeMagic_application_x_epoc_sheet = 61,    // application/x-epoc-sheet
+    MimeMagic_application_x_epoc_word = 62,    // application/x-epoc-word
+    MimeMagic_application_x_executable = 63,    // application/x-executable
+    MimeMagic_application_x_font_sfn = 64,    // application/x-font-sfn
+    MimeMagic_application_x_font_ttf = 65,    // application/x-font-ttf
+    MimeMagic_application_x_freemind = 66,    // application/x-freemind
+    MimeMagic_application_x_freeplane = 67,    // application/x-freeplane
+    MimeMagic_application_x_gdbm = 68,    // application/x-gdbm
+    MimeMagic_application_x_gnucash = 69,    // application/x-gnucash
+    MimeMagic_application_x_gnupg_keyring = 70,    // application/x-gnupg-keyring
+    MimeMagic_application_x_hdf = 71,    // application/x-hdf
+    MimeMagic_application_x_hwp = 72,    // application/x-hwp
+    MimeMagic_application_x_ia_arc = 73,    // application/x-ia-arc
+    MimeMagic_application_x_ichitaro4 = 74,    // application/x-ichitaro4
+    MimeMagic_application_x_ichitaro5 = 75,    // application/x-ichitaro5
+    MimeMagic_application_x_ichitaro6 = 76,    // application/x-ichitaro6
+    MimeMagic_application_x_ima = 77,    // application/x-ima
+    MimeMagic_application_x_iso9660_image = 78,    // application/x-iso9660-image
+    MimeMagic_application_x_java_applet = 79,    // application/x-java-applet
+    MimeMagic_application_x_java_pack200 = 80,    // application/x-java-pack200
+    MimeMagic_application_x_kdelnk = 81,    // application/x-kdelnk
+    MimeMagic_application_x_lrzip = 82,    // application/x-lrzip
+    MimeMagic_application_x_lz4 = 83,    // application/x-lz4
+    MimeMagic_application_x_lzma = 84,    // application/x-lzma
+    MimeMagic_application_x_mif = 85,    // application/x-mif
+    MimeMagic_application_x_ms_reader = 86,    // application/x-ms-reader
+    MimeMagic_application_x_msaccess = 87,    // application/x-msaccess
+    MimeMagic_application_x_object = 88,    // application/x-object
+    MimeMagic_application_x_pgp_keyring = 89,    // application/x-pgp-keyring
+    MimeMagic_application_x_pnf = 90,    // application/x-pnf
+    MimeMagic_application_x_quicktime_player = 91,    // application/x-quicktime-player
+    MimeMagic_application_x_rar = 92,    // application/x-rar
+    MimeMagic_application_x_rpm = 93,    // application/x-rpm
+    MimeMagic_application_x_scribus = 94,    // application/x-scribus
+    MimeMagic_application_x_setupscript = 95,    // application/x-setupscript
+    MimeMagic_application_x_sharedlib = 96,    // application/x-sharedlib
+    MimeMagic_application_x_shockwave_flash = 97,    // application/x-shockwave-flash
+    MimeMagic_application_x_svr4_package = 98,    // application/x-svr4-package
+    MimeMagic_application_x_tar = 99,    // application/x-tar
+    MimeMagic_application_x_tex_tfm = 100,    // application/x-tex-tfm
+    MimeMagic_application_x_wine_extension_ini = 101,    // application/x-wine-extension-ini
+    MimeMagic_application_x_xz = 102,    // application/x-xz
+    MimeMagic_application_xml = 103,    // application/xml
+    MimeMagic_application_xml_sitemap = 104,    // application/xml-sitemap
+    MimeMagic_application_zip = 105,    // application/zip
+    MimeMagic_audio_basic = 106,    // audio/basic
+    MimeMagic_audio_midi = 107,    // audio/midi
+    MimeMagic_audio_mp4 = 108,    // audio/mp4
+    MimeMagic_audio_mpeg = 109,    // audio/mpeg
+    MimeMagic_audio_vnd_dolby_dd_raw = 110,    // audio/vnd.dolby.dd-raw
+    MimeMagic_audio_x_adpcm = 111,    // audio/x-adpcm
+    MimeMagic_audio_x_ape = 112,    // audio/x-ape
+    MimeMagic_audio_x_flac = 113,    // audio/x-flac
+    MimeMagic_audio_x_hx_aac_adif = 114,    // audio/x-hx-aac-adif
+    MimeMagic_audio_x_hx_aac_adts = 115,    // audio/x-hx-aac-adts
+    MimeMagic_audio_x_mp4a_latm = 116,    // audio/x-mp4a-latm
+    MimeMagic_audio_x_musepack = 117,    // audio/x-musepack
+    MimeMagic_audio_x_pn_realaudio = 118,    // audio/x-pn-realaudio
+    MimeMagic_audio_x_wav = 119,    // audio/x-wav
+    MimeMagic_chemical_x_pdb = 120,    // chemical/x-pdb
+    MimeMagic_image_gif = 121,    // image/gif
+    MimeMagic_image_jp2 = 122,    // image/jp2
+    MimeMagic_image_jpeg = 123,    // image/jpeg
+    MimeMagic_image_jpm = 124,    // image/jpm
+    MimeMagic_image_jpx = 125,    // image/jpx
+    MimeMagic_image_png = 126,    // image/png
+    MimeMagic_image_svg_xml = 127,    // image/svg+xml
+    MimeMagic_image_tiff = 128,    // image/tiff
+    MimeMagic_image_vnd_adobe_photoshop = 129,    // image/vnd.adobe.photoshop
+    MimeMagic_image_vnd_djvu = 130,    // image/vnd.djvu
+    MimeMagic_image_vnd_dwg = 131,    // image/vnd.dwg
+    MimeMagic_image_webp = 132,    // image/webp
+    MimeMagic_image_x_award_bmp = 133,    // image/x-award-bmp
+    MimeMagic_image_x_canon_cr2 = 134,    // image/x-canon-cr2
+    MimeMagic_image_x_canon_crw = 135,    // image/x-canon-crw
+    MimeMagic_image_x_coreldraw = 136,    // image/x-coreldraw
+    MimeMagic_image_x_cur = 137,    // image/x-cur
+    MimeMagic_image_x_epoc_sketch = 138,    // image/x-epoc-sketch
+    MimeMagic_image_x_exr = 139,    // image/x-exr
+    MimeMagic_image_x_icon = 140,    // image/x-icon
+    MimeMagic_image_x_ms_bmp = 141,    // image/x-ms-bmp
+    MimeMagic_image_x_olympus_orf = 142,    // image/x-olympus-orf
+    MimeMagic_image_x_paintnet = 143,    // image/x-paintnet
+    MimeMagic_image_x_pcx = 144,    // image/x-pcx
+    MimeMagic_image_x_polar_monitor_bitmap = 145,    // image/x-polar-monitor-bitmap
+    MimeMagic_image_x_portable_bitmap = 146,    // image/x-portable-bitmap
+    MimeMagic_image_x_portable_greymap = 147,    // image/x-portable-greymap
+    MimeMagic_image_x_portable_pixmap = 148,    // image/x-portable-pixmap
+    MimeMagic_image_x_quicktime = 149,    // image/x-quicktime
+    MimeMagic_image_x_xcf = 150,    // image/x-xcf
+    MimeMagic_image_x_xcursor = 151,    // image/x-xcursor
+    MimeMagic_image_x_xpmi = 152,    // image/x-xpmi
+    MimeMagic_image_x_xwindowdump = 153,    // image/x-xwindowdump
+    MimeMagic_model_vrml = 154,    // model/vrml
+    MimeMagic_model_x3d = 155,    // model/x3d
+    MimeMagic_rinex_broadcast = 156,    // rinex/broadcast
+    MimeMagic_rinex_clock = 157,    // rinex/clock
+    MimeMagic_rinex_meteorological = 158,    // rinex/meteorological
+    MimeMagic_rinex_navigation = 159,    // rinex/navigation
+    MimeMagic_rinex_observation = 160,    // rinex/observation
+    MimeMagic_text_PGP = 161,    // text/PGP
+    MimeMagic_text_calendar = 162,    // text/calendar
+    MimeMagic_text_html = 163,    // text/html
+    MimeMagic_text_inf = 164,    // text/inf
+    MimeMagic_text_rtf = 165,    // text/rtf
+    MimeMagic_text_texmacs = 166,    // text/texmacs
+    MimeMagic_text_x_awk = 167,    // text/x-awk
+    MimeMagic_text_x_gawk = 168,    // text/x-gawk
+    MimeMagic_text_x_info = 169,    // text/x-info
+    MimeMagic_text_x_lua = 170,    // text/x-lua
+    MimeMagic_text_x_msdos_batch = 171,    // text/x-msdos-batch
+    MimeMagic_text_x_nawk = 172,    // text/x-nawk
+    MimeMagic_text_x_perl = 173,    // text/x-perl
+    MimeMagic_text_x_php = 174,    // text/x-php
+    MimeMagic_text_x_python = 175,    // text/x-python
+    MimeMagic_text_x_ruby = 176,    // text/x-ruby
+    MimeMagic_text_x_shellscript = 177,    // text/x-shellscript
+    MimeMagic_text_x_tcl = 178,    // text/x-tcl
+    MimeMagic_text_x_tex = 179,    // text/x-tex
+    MimeMagic_text_x_texinfo = 180,    // text/x-texinfo
+    MimeMagic_text_x_vcard = 181,    // text/x-vcard
+    MimeMagic_text_x_xmcd = 182,    // text/x-xmcd
+    MimeMagic_video_3gpp = 183,    // video/3gpp
+    MimeMagic_video_3gpp2 = 184,    // video/3gpp2
+    MimeMagic_video_mj2 = 185,    // video/mj2
+    MimeMagic_video_mp4 = 186,    // video/mp4
+    MimeMagic_video_mpeg = 187,    // video/mpeg
+    MimeMagic_video_mpeg4_generic = 188,    // video/mpeg4-generic
+    MimeMagic_video_quicktime = 189,    // video/quicktime
+    MimeMagic_video_webm = 190,    // video/webm
+    MimeMagic_video_x_flc = 191,    // video/x-flc
+    MimeMagic_video_x_fli = 192,    // video/x-fli
+    MimeMagic_video_x_flv = 193,    // video/x-flv
+    MimeMagic_video_x_matroska = 194,    // video/x-matroska
+    MimeMagic_video_x_mng = 195,    // video/x-mng
+    MimeMagic_video_x_ms_asf = 196,    // video/x-ms-asf
+    MimeMagic_video_x_msvideo = 197,    // video/x-msvideo
+    MimeMagic_x_epoc_x_sisx_app = 198,    // x-epoc/x-sisx-app
+    MimeMagic_image_bmp = 199,    // image/bmp
+    MimeMagicIdCount = 200
+};
+
+#ifdef __cplusplus
+namespace mimemagic
+{
+namespace id
+{
+    constexpr MimeMagicId text_plain_charset_US_ASCII = MimeMagic_text_plain_charset_US_ASCII;
+    constexpr MimeMagicId text_plain_charset_UTF_8 = MimeMagic_text_plain_charset_UTF_8;
+    constexpr MimeMagicId text_plain_charset_UTF_16 = MimeMagic_text_plain_charset_UTF_16;
+    constexpr MimeMagicId application_dicom = MimeMagic_application_dicom;
+    constexpr MimeMagicId application_epub_zip = MimeMagic_application_epub_zip;
+    constexpr MimeMagicId application_java_archive = MimeMagic_application_java_archive;
+    constexpr MimeMagicId application_javascript = MimeMagic_application_javascript;
+    constexpr MimeMagicId application_msword = MimeMagic_application_msword;
+    constexpr MimeMagicId application_octet_stream = MimeMagic_application_octet_stream;
+    constexpr MimeMagicId application_ogg = MimeMagic_application_ogg;
+    constexpr MimeMagicId application_pdf = MimeMagic_application_pdf;
+    constexpr MimeMagicId application_pgp = MimeMagic_application_pgp;
+    constexpr MimeMagicId application_pgp_keys = MimeMagic_application_pgp_keys;
+    constexpr MimeMagicId application_pgp_signature = MimeMagic_application_pgp_signature;
+    constexpr MimeMagicId application_postscript = MimeMagic_application_postscript;
+    constexpr MimeMagicId application_unknown_zip = MimeMagic_application_unknown_zip;
+    constexpr MimeMagicId application_vnd_cups_raster = MimeMagic_application_vnd_cups_raster;
+    constexpr MimeMagicId application_vnd_debian_binary_package = MimeMagic_application_vnd_debian_binary_package;
+    constexpr MimeMagicId application_vnd_fdf = MimeMagic_application_vnd_fdf;
+    constexpr MimeMagicId application_vnd_google_earth_kml_xml = MimeMagic_application_vnd_google_earth_kml_xml;
+    constexpr MimeMagicId application_vnd_google_earth_kmz = MimeMagic_application_vnd_google_earth_kmz;
+    constexpr MimeMagicId application_vnd_ms_cab_compressed = MimeMagic_application_vnd_ms_cab_compressed;
+    constexpr MimeMagicId application_vnd_ms_excel = MimeMagic_application_vnd_ms_excel;
+    constexpr MimeMagicId application_vnd_ms_fontobject = MimeMagic_application_vnd_ms_fontobject;
+    constexpr MimeMagicId application_vnd_ms_opentype = MimeMagic_application_vnd_ms_opentype;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_chart = MimeMagic_application_vnd_oasis_opendocument_chart;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_chart_template = MimeMagic_application_vnd_oasis_opendocument_chart_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_database = MimeMagic_application_vnd_oasis_opendocument_database;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_formula = MimeMagic_application_vnd_oasis_opendocument_formula;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_formula_template = MimeMagic_application_vnd_oasis_opendocument_formula_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_graphics = MimeMagic_application_vnd_oasis_opendocument_graphics;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_graphics_template = MimeMagic_application_vnd_oasis_opendocument_graphics_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_image = MimeMagic_application_vnd_oasis_opendocument_image;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_image_template = MimeMagic_application_vnd_oasis_opendocument_image_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_presentation = MimeMagic_application_vnd_oasis_opendocument_presentation;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_presentation_template = MimeMagic_application_vnd_oasis_opendocument_presentation_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_spreadsheet = MimeMagic_application_vnd_oasis_opendocument_spreadsheet;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_spreadsheet_template = MimeMagic_application_vnd_oasis_opendocument_spreadsheet_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_text = MimeMagic_application_vnd_oasis_opendocument_text;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_text_master = MimeMagic_application_vnd_oasis_opendocument_text_master;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_text_template = MimeMagic_application_vnd_oasis_opendocument_text_template;
+    constexpr MimeMagicId application_vnd_oasis_opendocument_text_web = MimeMagic_application_vnd_oasis_opendocument_text_web;
+    constexpr MimeMagicId application_vnd_openxmlformats_officedocument_presentationml_presentation = MimeMagic_application_vnd_openxmlformats_officedocument_presentationml_presentation;
+    constexpr MimeMagicId application_vnd_openxmlformats_officedocument_spreadsheetml_sheet = MimeMagic_application_vnd_openxmlformats_officedocument_spreadsheetml_sheet;
+    constexpr MimeMagicId application_vnd_openxmlformats_officedocument_wordprocessingml_document = MimeMagic_application_vnd_openxmlformats_officedocument_wordprocessingml_document;
+    constexpr MimeMagicId application_vnd_rn_realmedia = MimeMagic_application_vnd_rn_realmedia;
+    constexpr MimeMagicId application_x_7z_compressed = MimeMagic_application_x_7z_compressed;
+    constexpr MimeMagicId application_x_abook_addressbook = MimeMagic_application_x_abook_addressbook;
+    constexpr MimeMagicId application_x_bittorrent = MimeMagic_application_x_bittorrent;
+    constexpr MimeMagicId application_x_bzip2 = MimeMagic_application_x_bzip2;
+    constexpr MimeMagicId application_x_coredump = MimeMagic_application_x_coredump;
+    constexpr MimeMagicId application_x_dbf = MimeMagic_application_x_dbf;
+    constexpr MimeMagicId application_x_dvi = MimeMagic_application_x_dvi;
+    constexpr MimeMagicId application_x_eet = MimeMagic_application_x_eet;
+    constexpr MimeMagicId application_x_epoc_agenda = MimeMagic_application_x_epoc_agenda;
+    constexpr MimeMagicId application_x_epoc_app = MimeMagic_application_x_epoc_app;
+    constexpr MimeMagicId application_x_epoc_data = MimeMagic_application_x_epoc_data;
+    constexpr MimeMagicId application_x_epoc_jotter = MimeMagic_application_x_epoc_jotter;
+    constexpr MimeMagicId application_x_epoc_opl = MimeMagic_application_x_epoc_opl;
+    constexpr MimeMagicId application_x_epoc_opo = MimeMagic_application_x_epoc_opo;
+    constexpr MimeMagicId application_x_epoc_sheet = MimeMagic_application_x_epoc_sheet;
+    constexpr MimeMagicId application_x_epoc_word = MimeMagic_application_x_epoc_word;
+    constexpr MimeMagicId application_x_executable = MimeMagic_application_x_executable;
+    constexpr MimeMagicId application_x_font_sfn = MimeMagic_application_x_font_sfn;
+    constexpr MimeMagicId application_x_font_ttf = MimeMagic_application_x_font_ttf;
+    constexpr MimeMagicId application_x_freemind = MimeMagic_application_x_freemind;
+    constexpr MimeMagicId application_x_freeplane = MimeMagic_application_x_freeplane;
+    constexpr MimeMagicId application_x_gdbm = MimeMagic_application_x_gdbm;
+    constexpr MimeMagicId application_x_gnucash = MimeMagic_application_x_gnucash;
+    constexpr MimeMagicId application_x_gnupg_keyring = MimeMagic_application_x_gnupg_keyring;
+    constexpr MimeMagicId application_x_hdf = MimeMagic_application_x_hdf;
+    constexpr MimeMagicId application_x_hwp = MimeMagic_application_x_hwp;
+    constexpr MimeMagicId application_x_ia_arc = MimeMagic_application_x_ia_arc;
+    constexpr MimeMagicId application_x_ichitaro4 = MimeMagic_application_x_ichitaro4;
+    constexpr MimeMagicId application_x_ichitaro5 = MimeMagic_application_x_ichitaro5;
+    constexpr MimeMagicId application_x_ichitaro6 = MimeMagic_application_x_ichitaro6;
+    constexpr MimeMagicId application_x_ima = MimeMagic_application_x_ima;
+    constexpr MimeMagicId application_x_iso9660_image = MimeMagic_application_x_iso9660_image;
+    constexpr MimeMagicId application_x_java_applet = MimeMagic_application_x_java_applet;
+    constexpr MimeMagicId application_x_java_pack200 = MimeMagic_application_x_java_pack200;
+    constexpr MimeMagicId application_x_kdelnk = MimeMagic_application_x_kdelnk;
+    constexpr MimeMagicId application_x_lrzip = MimeMagic_application_x_lrzip;
+    constexpr MimeMagicId application_x_lz4 = MimeMagic_application_x_lz4;
+    constexpr MimeMagicId application_x_lzma = MimeMagic_application_x_lzma;
+    constexpr MimeMagicId application_x_mif = MimeMagic_application_x_mif;
+    constexpr MimeMagicId application_x_ms_reader = MimeMagic_application_x_ms_reader;
+    constexpr MimeMagicId application_x_msaccess = MimeMagic_application_x_msaccess;
+    constexpr MimeMagicId application_x_object = MimeMagic_application_x_object;
+    constexpr MimeMagicId application_x_pgp_keyring = MimeMagic_application_x_pgp_keyring;
+    constexpr MimeMagicId application_x_pnf = MimeMagic_application_x_pnf;
+    constexpr MimeMagicId application_x_quicktime_player = MimeMagic_application_x_quicktime_player;
+    constexpr MimeMagicId application_x_rar = MimeMagic_application_x_rar;
+    constexpr MimeMagicId application_x_rpm = MimeMagic_application_x_rpm;
+    constexpr MimeMagicId application_x_scribus = MimeMagic_application_x_scribus;
+    constexpr MimeMagicId application_x_setupscript = MimeMagic_application_x_setupscript;
+    constexpr MimeMagicId application_x_sharedlib = MimeMagic_application_x_sharedlib;
+    constexpr MimeMagicId application_x_shockwave_flash = MimeMagic_application_x_shockwave_flash;
+    constexpr MimeMagicId application_x_svr4_package = MimeMagic_application_x_svr4_package;
+    constexpr MimeMagicId application_x_tar = MimeMagic_application_x_tar;
+    constexpr MimeMagicId application_x_tex_tfm = MimeMagic_application_x_tex_tfm;
+    constexpr MimeMagicId application_x_wine_extension_ini = MimeMagic_application_x_wine_extension_ini;
+    constexpr MimeMagicId application_x_xz = MimeMagic_application_x_xz;
+    constexpr MimeMagicId application_xml = MimeMagic_application_xml;
+    constexpr MimeMagicId application_xml_sitemap = MimeMagic_application_xml_sitemap;
+    constexpr MimeMagicId application_zip = MimeMagic_application_zip;
+    constexpr MimeMagicId audio_basic = MimeMagic_audio_basic;
+    constexpr MimeMagicId audio_midi = MimeMagic_audio_midi;
+    constexpr MimeMagicId audio_mp4 = MimeMagic_audio_mp4;
+    constexpr MimeMagicId audio_mpeg = MimeMagic_audio_mpeg;
+    constexpr MimeMagicId audio_vnd_dolby_dd_raw = MimeMagic_audio_vnd_dolby_dd_raw;
+    constexpr MimeMagicId audio_x_adpcm = MimeMagic_audio_x_adpcm;
+    constexpr MimeMagicId audio_x_ape = MimeMagic_audio_x_ape;
+    constexpr MimeMagicId audio_x_flac = MimeMagic_audio_x_flac;
+    constexpr MimeMagicId audio_x_hx_aac_adif = MimeMagic_audio_x_hx_aac_adif;
+    constexpr MimeMagicId audio_x_hx_aac_adts = MimeMagic_audio_x_hx_aac_adts;
+    constexpr MimeMagicId audio_x_mp4a_latm = MimeMagic_audio_x_mp4a_latm;
+    constexpr MimeMagicId audio_x_musepack = MimeMagic_audio_x_musepack;
+    constexpr MimeMagicId audio_x_pn_realaudio = MimeMagic_audio_x_pn_realaudio;
+    constexpr MimeMagicId audio_x_wav = MimeMagic_audio_x_wav;
+    constexpr MimeMagicId chemical_x_pdb = MimeMagic_chemical_x_pdb;
+    constexpr MimeMagicId image_gif = MimeMagic_image_gif;
+    constexpr MimeMagicId image_jp2 = MimeMagic_image_jp2;
+    constexpr MimeMagicId image_jpeg = MimeMagic_image_jpeg;
+    constexpr MimeMagicId image_jpm = MimeMagic_image_jpm;
+    constexpr MimeMagicId image_jpx = MimeMagic_image_jpx;
+    constexpr MimeMagicId image_png = MimeMagic_image_png;
+    constexpr MimeMagicId image_svg_xml = MimeMagic_image_svg_xml;
+    constexpr MimeMagicId image_tiff = MimeMagic_image_tiff;
+    constexpr MimeMagicId image_vnd_adobe_photoshop = MimeMagic_image_vnd_adobe_photoshop;
+    constexpr MimeMagicId image_vnd_djvu = MimeMagic_image_vnd_djvu;
+    constexpr MimeMagicId image_vnd_dwg = MimeMagic_image_vnd_dwg;
+    constexpr MimeMagicId image_webp = MimeMagic_image_webp;
+    constexpr MimeMagicId image_x_award_bmp = MimeMagic_image_x_award_bmp;
+    constexpr MimeMagicId image_x_canon_cr2 = MimeMagic_image_x_canon_cr2;
+    constexpr MimeMagicId image_x_canon_crw = MimeMagic_image_x_canon_crw;
+    constexpr MimeMagicId image_x_coreldraw = MimeMagic_image_x_coreldraw;
+    constexpr MimeMagicId image_x_cur = MimeMagic_image_x_cur;
+    constexpr MimeMagicId image_x_epoc_sketch = MimeMagic_image_x_epoc_sketch;
+    constexpr MimeMagicId image_x_exr = MimeMagic_image_x_exr;
+    constexpr MimeMagicId image_x_icon = MimeMagic_image_x_icon;
+    constexpr MimeMagicId image_x_ms_bmp = MimeMagic_image_x_ms_bmp;
+    constexpr MimeMagicId image_x_olympus_orf = MimeMagic_image_x_olympus_orf;
+    constexpr MimeMagicId image_x_paintnet = MimeMagic_image_x_paintnet;
+    constexpr MimeMagicId image_x_pcx = MimeMagic_image_x_pcx;
+    constexpr MimeMagicId image_x_polar_monitor_bitmap = MimeMagic_image_x_polar_monitor_bitmap;
+    constexpr MimeMagicId image_x_portable_bitmap = MimeMagic_image_x_portable_bitmap;
+    constexpr MimeMagicId image_x_portable_greymap = MimeMagic_image_x_portable_greymap;
+    constexpr MimeMagicId image_x_portable_pixmap = MimeMagic_image_x_portable_pixmap;
+    constexpr MimeMagicId image_x_quicktime = MimeMagic_image_x_quicktime;
+    constexpr MimeMagicId image_x_xcf = MimeMagic_image_x_xcf;
+    constexpr MimeMagicId image_x_xcursor = MimeMagic_image_x_xcursor;
+    constexpr MimeMagicId image_x_xpmi = MimeMagic_image_x_xpmi;
+    constexpr MimeMagicId image_x_xwindowdump = MimeMagic_image_x_xwindowdump;
+    constexpr MimeMagicId model_vrml = MimeMagic_model_vrml;
+    constexpr MimeMagicId model_x3d = MimeMagic_model_x3d;
+    constexpr MimeMagicId rinex_broadcast = MimeMagic_rinex_broadcast;
+    constexpr MimeMagicId rinex_clock = MimeMagic_rinex_clock;
+    constexpr MimeMagicId rinex_meteorological = MimeMagic_rinex_meteorological;
+    constexpr MimeMagicId rinex_navigation = MimeMagic_rinex_navigation;
+    constexpr MimeMagicId rinex_observation = MimeMagic_rinex_observation;
+    constexpr MimeMagicId text_PGP = MimeMagic_text_PGP;
+    constexpr MimeMagicId text_calendar = MimeMagic_text_calendar;
+    constexpr MimeMagicId text_html = MimeMagic_text_html;
+    constexpr MimeMagicId text_inf = MimeMagic_text_inf;
+    constexpr MimeMagicId text_rtf = MimeMagic_text_rtf;
+    constexpr MimeMagicId text_texmacs = MimeMagic_text_texmacs;
+    constexpr MimeMagicId text_x_awk = MimeMagic_text_x_awk;
+    constexpr MimeMagicId text_x_gawk = MimeMagic_text_x_gawk;
+    constexpr MimeMagicId text_x_info = MimeMagic_text_x_info;
+    constexpr MimeMagicId text_x_lua = MimeMagic_text_x_lua;
+    constexpr MimeMagicId text_x_msdos_batch = MimeMagic_text_x_msdos_batch;
+    constexpr MimeMagicId text_x_nawk = MimeMagic_text_x_nawk;
+    constexpr MimeMagicId text_x_perl = MimeMagic_text_x_perl;
+    constexpr MimeMagicId text_x_php = MimeMagic_text_x_php;
+    constexpr MimeMagicId text_x_python = MimeMagic_text_x_python;
+    constexpr MimeMagicId text_x_ruby = MimeMagic_text_x_ruby;
+    constexpr MimeMagicId text_x_shellscript = MimeMagic_text_x_shellscript;
+    constexpr MimeMagicId text_x_tcl = MimeMagic_text_x_tcl;
+    constexpr MimeMagicId text_x_tex = MimeMagic_text_x_tex;
+    constexpr MimeMagicId text_x_texinfo = MimeMagic_text_x_texinfo;
+    constexpr MimeMagicId text_x_vcard = MimeMagic_text_x_vcard;
+    constexpr MimeMagicId text_x_xmcd = MimeMagic_text_x_xmcd;
+    constexpr MimeMagicId video_3gpp = MimeMagic_video_3gpp;
+    constexpr MimeMagicId video_3gpp2 = MimeMagic_video_3gpp2;
+    constexpr MimeMagicId video_mj2 = MimeMagic_video_mj2;
+    constexpr MimeMagicId video_mp4 = MimeMagic_video_mp4;
+    constexpr MimeMagicId video_mpeg = MimeMagic_video_mpeg;
+    constexpr MimeMagicId video_mpeg4_generic = MimeMagic_video_mpeg4_generic;
+    constexpr MimeMagicId video_quicktime = MimeMagic_video_quicktime;
+    constexpr MimeMagicId video_webm = MimeMagic_video_webm;
+    constexpr MimeMagicId video_x_flc = MimeMagic_video_x_flc;
+    constexpr MimeMagicId video_x_fli = MimeMagic_video_x_fli;
+    constexpr MimeMagicId video_x_flv = MimeMagic_video_x_flv;
+    constexpr MimeMagicId video_x_matroska = MimeMagic_video_x_matroska;
+    constexpr MimeMagicId video_x_mng = MimeMagic_video_x_mng;
+    constexpr MimeMagicId video_x_ms_asf = MimeMagic_video_x_ms_asf;
+    constexpr MimeMagicId video_x_msvideo = MimeMagic_video_x_msvideo;
+    constexpr MimeMagicId x_epoc_x_sisx_app = MimeMagic_x_epoc_x_sisx_app;
+    constexpr MimeMagicId image_bmp = MimeMagic_image_bmp;
+}
+}
+#endif /* __cplusplus */
+
+#endif // MIME_MAGIC_IDS_HH
@@ -0,0 +1,779 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  mimemagicd classifies buffers for other processes over a Unix domain
+    socket. See mimemagicd.h for the protocol.
+
+    The main thread waits on the listening socket and the idle
+    connections with epoll. A connection with a request ready is queued
+    for the pool of workers. A worker serves one batch from it and then
+    hands it back to epoll, so a busy client doesn't hold a worker and
+    the batches from all clients are served in turn.
+
+    The results are kept in a cache shared by the workers. It is keyed
+    by a hash of the data that was classified, its length and the flags,
+    so the same content is found whether it came from a file or inline.
+    The hash is SipHash with a key drawn at start up, so a client can't
+    make data that collides with another client's and be given its type.
+    The MIME strings are the library's constants so they can be kept.
+*/
+
+#define _GNU_SOURCE             // for accept4()
+
+#include <endian.h>
+#include <errno.h>
+#include <getopt.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/epoll.h>
+#include <sys/random.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include "mimemagic.h"
+#include "mimemagicd.h"
+
+//======================================================================
+
+typedef unsigned char Byte;
+
+static const char*  socketPath = "/tmp/mimemagicd.sock";
+static size_t       readLimit  = 16384;
+static int          readMsecs  = 1000;
+static int          epollFd    = -1;
+
+static volatile sig_atomic_t stopping;
+
+//======================================================================
+
+/*  A direct mapped cache. The entries are guarded by striped locks.
+    A key of 0 marks an empty entry.
+*/
+typedef struct CacheEntry
+{
+    uint64_t    key;
+    uint32_t    len;
+    uint8_t     flags;
+    int8_t      result;
+    const char* mime;
+} CacheEntry;
+
+enum
+{
+    CacheLocks = 64,
+    MaxName    = 255,
+};
+
+static CacheEntry*      cache;
+static size_t           cacheSize = 65536;
+static pthread_mutex_t  cacheLocks[CacheLocks];
+
+
+
+static uint64_t hashKey[2];     // from getrandom() in main()
+
+
+
+static inline uint64_t
+rotl(uint64_t x, int n)
+{
+    return x << n | x >> (64 - n);
+}
+
+
+
+static inline void
+sipRound(uint64_t* v)
+{
+    v[0] += v[1]; v[1] = rotl(v[1], 13); v[1] ^= v[0]; v[0] = rotl(v[0], 32);
+    v[2] += v[3]; v[3] = rotl(v[3], 16); v[3] ^= v[2];
+    v[0] += v[3]; v[3] = rotl(v[3], 21); v[3] ^= v[0];
+    v[2] += v[1]; v[1] = rotl(v[1], 17); v[1] ^= v[2]; v[2] = rotl(v[2], 32);
+}
+
+
+
+static uint64_t
+hashBytes(const Byte* buf, size_t len)
+{
+    // SipHash-2-4 of the data, a word at a time as it can be many KB.
+    uint64_t    v[4];
+    uint64_t    last = (uint64_t)len << 56;
+    size_t      i;
+
+    v[0] = hashKey[0] ^ 0x736f6d6570736575ULL;
+    v[1] = hashKey[1] ^ 0x646f72616e646f6dULL;
+    v[2] = hashKey[0] ^ 0x6c7967656e657261ULL;
+    v[3] = hashKey[1] ^ 0x7465646279746573ULL;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        uint64_t w;
+
+        memcpy(&w, buf + i, 8);
+        w     = le64toh(w);
+        v[3] ^= w;
+        sipRound(v);
+        sipRound(v);
+        v[0] ^= w;
+    }
+
+    for (; i < len; ++i)
+    {
+        last |= (uint64_t)buf[i] << (8 * (i % 8));
+    }
+
+    v[3] ^= last;
+    sipRound(v);
+    sipRound(v);
+    v[0] ^= last;
+    v[2] ^= 0xff;
+
+    for (i = 0; i < 4; ++i)
+    {
+        sipRound(v);
+    }
+
+    last = v[0] ^ v[1] ^ v[2] ^ v[3];
+    return last ? last : 1;
+}
+
+
+
+static int
+classify(const Byte* buf, size_t len, int flags, const char** mime)
+{
+    uint64_t    key;
+    CacheEntry* e;
+    int         r;
+
+    if (!cache)
+    {
+        return getMimeType(buf, len, mime, flags);
+    }
+
+    key = hashBytes(buf, len);
+    e   = &cache[key & (cacheSize - 1)];
+
+    pthread_mutex_lock(&cacheLocks[key % CacheLocks]);
+
+    if (e->key == key && e->len == len && e->flags == flags)
+    {
+        r     = e->result;
+        *mime = e->mime;
+        pthread_mutex_unlock(&cacheLocks[key % CacheLocks]);
+        return r;
+    }
+
+    pthread_mutex_unlock(&cacheLocks[key % CacheLocks]);
+
+    *mime = NULL;
+    r = getMimeType(buf, len, mime, flags);
+
+    pthread_mutex_lock(&cacheLocks[key % CacheLocks]);
+    e->key    = key;
+    e->len    = len;
+    e->flags  = flags;
+    e->result = r;
+    e->mime   = *mime;
+    pthread_mutex_unlock(&cacheLocks[key % CacheLocks]);
+
+    return r;
+}
+
+//======================================================================
+
+/*  The queue of connections with a request ready. A connection is in
+    it at most once, because of EPOLLONESHOT.
+*/
+static pthread_mutex_t  queueLock  = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   queueReady = PTHREAD_COND_INITIALIZER;
+static int*             queue;
+static size_t           queueSize;
+static size_t           queueHead;
+static size_t           queueCount;
+
+
+
+static void
+queuePush(int fd)
+{
+    pthread_mutex_lock(&queueLock);
+
+    if (queueCount == queueSize)
+    {
+        // Grow and unwrap the ring.
+        size_t  size = queueSize ? 2 * queueSize : 64;
+        int*    q    = (int*)malloc(size * sizeof(int));
+        size_t  i;
+
+        if (!q)
+        {
+            pthread_mutex_unlock(&queueLock);
+            close(fd);
+            return;
+        }
+
+        for (i = 0; i < queueCount; ++i)
+        {
+            q[i] = queue[(queueHead + i) % queueSize];
+        }
+
+        free(queue);
+        queue     = q;
+        queueSize = size;
+        queueHead = 0;
+    }
+
+    queue[(queueHead + queueCount) % queueSize] = fd;
+    ++queueCount;
+
+    pthread_cond_signal(&queueReady);
+    pthread_mutex_unlock(&queueLock);
+}
+
+
+
+static int
+queuePop()
+{
+    int fd;
+
+    pthread_mutex_lock(&queueLock);
+
+    while (queueCount == 0)
+    {
+        pthread_cond_wait(&queueReady, &queueLock);
+    }
+
+    fd = queue[queueHead];
+    queueHead = (queueHead + 1) % queueSize;
+    --queueCount;
+
+    pthread_mutex_unlock(&queueLock);
+    return fd;
+}
+
+//======================================================================
+
+typedef struct Worker
+{
+    Byte*   data;           // MmdMaxInline bytes
+    Byte*   reply;
+    size_t  replyLen;
+    int     fds[MmdMaxFds];
+    size_t  numFds;
+} Worker;
+
+
+
+static int
+readFull(int fd, void* buf, size_t len)
+{
+    Byte* bp = (Byte*)buf;
+
+    while (len > 0)
+    {
+        ssize_t n = read(fd, bp, len);
+
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (n <= 0)
+        {
+            return -1;
+        }
+
+        bp  += n;
+        len -= n;
+    }
+
+    return 0;
+}
+
+
+
+static int
+writeFull(int fd, const void* buf, size_t len)
+{
+    const Byte* bp = (const Byte*)buf;
+
+    while (len > 0)
+    {
+        ssize_t n = send(fd, bp, len, MSG_NOSIGNAL);
+
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (n <= 0)
+        {
+            return -1;
+        }
+
+        bp  += n;
+        len -= n;
+    }
+
+    return 0;
+}
+
+
+
+/*  Read the header with any descriptors that came with it.
+*/
+static int
+readHeader(Worker* w, int conn, MmdHeader* hdr)
+{
+    union
+    {
+        struct cmsghdr  align;
+        char            buf[CMSG_SPACE(MmdMaxFds * sizeof(int))];
+    } control;
+
+    struct iovec    iov = {hdr, sizeof(*hdr)};
+    struct msghdr   msg;
+    struct cmsghdr* cm;
+    ssize_t         n;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    do
+    {
+        n = recvmsg(conn, &msg, MSG_CMSG_CLOEXEC);
+    }
+    while (n < 0 && errno == EINTR);
+
+    if (n <= 0)
+    {
+        return -1;
+    }
+
+    for (cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm))
+    {
+        if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_RIGHTS)
+        {
+            size_t count = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+
+            memcpy(w->fds + w->numFds, CMSG_DATA(cm), count * sizeof(int));
+            w->numFds += count;
+        }
+    }
+
+    if (msg.msg_flags & MSG_CTRUNC)
+    {
+        return -1;
+    }
+
+    // The rest of the header may come separately.
+    if ((size_t)n < sizeof(*hdr) && readFull(conn, (Byte*)hdr + n, sizeof(*hdr) - n) < 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+
+static ssize_t
+readDescriptor(int fd, Byte* buf, size_t len)
+{
+    /*  From the start of a file, or what there is of a pipe or socket
+        by the deadline. A writer that never closes its end would
+        otherwise hold the worker for good.
+    */
+    struct timespec now;
+    long            deadline;
+    ssize_t         total = 0;
+    ssize_t         n     = pread(fd, buf, len, 0);
+
+    if (n >= 0 || errno != ESPIPE)
+    {
+        return n;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    deadline = now.tv_sec * 1000 + now.tv_nsec / 1000000 + readMsecs;
+
+    while ((size_t)total < len)
+    {
+        struct pollfd   pfd = {fd, POLLIN, 0};
+        long            wait;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        wait = deadline - (now.tv_sec * 1000 + now.tv_nsec / 1000000);
+
+        if (wait <= 0)
+        {
+            break;
+        }
+
+        n = poll(&pfd, 1, wait);
+
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (n < 0)
+        {
+            return -1;
+        }
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        n = read(fd, buf + total, len - total);
+
+        if (n < 0 && (errno == EINTR || errno == EAGAIN))
+        {
+            continue;
+        }
+
+        if (n < 0)
+        {
+            return -1;
+        }
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        total += n;
+    }
+
+    return total;
+}
+
+
+
+static void
+addReply(Worker* w, int result, const char* mime)
+{
+    MmdReply    rep;
+    size_t      nameLen = mime ? strlen(mime) : 0;
+
+    if (nameLen > MaxName)
+    {
+        nameLen = MaxName;
+    }
+
+    memset(&rep, 0, sizeof(rep));
+    rep.result  = result;
+    rep.nameLen = nameLen;
+
+    memcpy(w->reply + w->replyLen, &rep, sizeof(rep));
+    memcpy(w->reply + w->replyLen + sizeof(rep), mime, nameLen);
+    w->replyLen += sizeof(rep) + nameLen;
+}
+
+
+
+/*  Returns -1 if the connection should be closed.
+*/
+static int
+serveBatch(Worker* w, int conn)
+{
+    MmdHeader   hdr;
+    size_t      nextFd = 0;
+    int         ok     = -1;
+    uint32_t    i;
+
+    w->numFds   = 0;
+    w->replyLen = sizeof(hdr);
+
+    if (readHeader(w, conn, &hdr) < 0 || hdr.magic != MmdMagic || hdr.count > MmdMaxBatch)
+    {
+        goto done;
+    }
+
+    for (i = 0; i < hdr.count; ++i)
+    {
+        MmdItem     item;
+        const char* mime = NULL;
+        int         r;
+
+        if (readFull(conn, &item, sizeof(item)) < 0)
+        {
+            goto done;
+        }
+
+        if (item.source == MmdInline)
+        {
+            if (item.len > MmdMaxInline || readFull(conn, w->data, item.len) < 0)
+            {
+                goto done;
+            }
+
+            r = classify(w->data, item.len, item.flags, &mime);
+        }
+        else
+        if (item.source == MmdFromFd && nextFd < w->numFds)
+        {
+            size_t  len = item.len && item.len < readLimit ? item.len : readLimit;
+            ssize_t n   = readDescriptor(w->fds[nextFd++], w->data, len);
+
+            r = n < 0 ? MmdReadError : classify(w->data, n, item.flags, &mime);
+        }
+        else
+        {
+            goto done;
+        }
+
+        addReply(w, r, r > 0 ? mime : NULL);
+    }
+
+    memcpy(w->reply, &hdr, sizeof(hdr));
+    ok = writeFull(conn, w->reply, w->replyLen);
+
+done:
+    for (i = 0; i < w->numFds; ++i)
+    {
+        close(w->fds[i]);
+    }
+
+    return ok;
+}
+
+
+
+static void*
+workerMain(void* arg)
+{
+    Worker* w = (Worker*)arg;
+
+    for (;;)
+    {
+        int fd = queuePop();
+
+        if (serveBatch(w, fd) < 0)
+        {
+            close(fd);
+        }
+        else
+        {
+            struct epoll_event ev = {EPOLLIN | EPOLLONESHOT, {.fd = fd}};
+
+            if (epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &ev) < 0)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+//======================================================================
+
+static void
+usage()
+{
+    fprintf(stderr, "Usage: mimemagicd [-s socket] [-t threads] [-c cache entries] [-r read limit] [-w msecs]\n");
+}
+
+
+
+static void
+onSignal(int sig)
+{
+    stopping = 1;
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+    struct sockaddr_un  addr;
+    struct sigaction    sa;
+    long                threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int                 listenFd;
+    long                i;
+    int                 opt;
+
+    while ((opt = getopt(argc, argv, "c:hr:s:t:w:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'c':
+            cacheSize = strtoul(optarg, NULL, 0);
+            break;
+
+        case 'r':
+            readLimit = strtoul(optarg, NULL, 0);
+            break;
+
+        case 's':
+            socketPath = optarg;
+            break;
+
+        case 't':
+            threads = atol(optarg);
+            break;
+
+        case 'w':
+            readMsecs = atoi(optarg);
+            break;
+
+        case 'h':
+        default:
+            usage();
+            exit(1);
+        }
+    }
+
+    if (threads < 1 || readLimit == 0 || readLimit > MmdMaxInline || readMsecs < 0
+        || strlen(socketPath) >= sizeof(addr.sun_path))
+    {
+        usage();
+        exit(1);
+    }
+
+    // Without a secret key for the hash the cache could be poisoned.
+    if (cacheSize && getrandom(hashKey, sizeof(hashKey), 0) != sizeof(hashKey))
+    {
+        perror("mimemagicd: getrandom, running without the cache");
+        cacheSize = 0;
+    }
+
+    if (cacheSize)
+    {
+        // Round up to a power of 2.
+        size_t size = 1;
+
+        while (size < cacheSize)
+        {
+            size <<= 1;
+        }
+
+        cacheSize = size;
+        cache     = (CacheEntry*)calloc(cacheSize, sizeof(CacheEntry));
+
+        for (i = 0; i < CacheLocks; ++i)
+        {
+            pthread_mutex_init(&cacheLocks[i], NULL);
+        }
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = onSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socketPath);
+    unlink(socketPath);
+
+    if (listenFd < 0
+        || bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) < 0
+        || listen(listenFd, 128) < 0)
+    {
+        perror(socketPath);
+        exit(1);
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    {
+        struct epoll_event ev = {EPOLLIN, {.fd = listenFd}};
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+    }
+
+    for (i = 0; i < threads; ++i)
+    {
+        Worker*     w = (Worker*)calloc(1, sizeof(Worker));
+        pthread_t   tid;
+
+        w->data  = (Byte*)malloc(MmdMaxInline);
+        w->reply = (Byte*)malloc(sizeof(MmdHeader) + MmdMaxBatch * (sizeof(MmdReply) + MaxName));
+
+        if (!w->data || !w->reply || pthread_create(&tid, NULL, workerMain, w) != 0)
+        {
+            fprintf(stderr, "mimemagicd: cannot start the workers\n");
+            exit(1);
+        }
+
+        pthread_detach(tid);
+    }
+
+    while (!stopping)
+    {
+        struct epoll_event  events[64];
+        int                 n = epoll_wait(epollFd, events, 64, -1);
+
+        for (i = 0; i < n; ++i)
+        {
+            int fd = events[i].data.fd;
+
+            if (fd == listenFd)
+            {
+                // A stalled client mustn't hold a worker for long.
+                struct timeval  tv = {5, 0};
+                int             conn = accept4(listenFd, NULL, NULL, SOCK_CLOEXEC);
+
+                if (conn >= 0)
+                {
+                    struct epoll_event ev = {EPOLLIN | EPOLLONESHOT, {.fd = conn}};
+
+                    setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+                    epoll_ctl(epollFd, EPOLL_CTL_ADD, conn, &ev);
+                }
+            }
+            else
+            {
+                queuePush(fd);
+            }
+        }
+    }
+
+    unlink(socketPath);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+#ifndef MIME_MAGIC_D_HH
+#define MIME_MAGIC_D_HH
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+//======================================================================
+
+/*  The protocol of the mimemagicd daemon. The socket is local so all
+    integers are in the host's byte order.
+
+    A request is a MmdHeader followed by count items. Each item is a
+    MmdItem. An inline item is followed by its len bytes of data. The
+    descriptors for the MmdFromFd items are passed with SCM_RIGHTS in
+    the same sendmsg() as the MmdHeader, one per item in the order of
+    the items. The daemon reads from offset 0 of each and closes it.
+    A pipe or socket is read until EOF, len bytes or the daemon's read
+    timeout, and what arrived by then is classified.
+
+    The reply is a MmdHeader with the same count, then a MmdReply for
+    each item followed by nameLen bytes of the MIME type without a
+    terminating NUL. The result is as for getMimeType() or
+    MmdReadError if the descriptor couldn't be read.
+
+    A malformed request closes the connection.
+*/
+
+enum
+{
+    MmdMagic     = 0x31444d4d,      // "MMD1"
+    MmdMaxBatch  = 256,
+    MmdMaxFds    = 64,
+    MmdMaxInline = 1 << 20,
+    MmdReadError = -2,
+};
+
+
+enum MmdSource
+{
+    MmdFromFd = 0,
+    MmdInline = 1,
+};
+
+
+typedef struct MmdHeader
+{
+    uint32_t    magic;
+    uint32_t    count;
+} MmdHeader;
+
+
+/*  For a descriptor len is the most to read, 0 for the daemon's limit.
+    The flags are the MimeMagicFlags.
+*/
+typedef struct MmdItem
+{
+    uint8_t     source;
+    uint8_t     flags;
+    uint16_t    reserved;
+    uint32_t    len;
+} MmdItem;
+
+
+typedef struct MmdReply
+{
+    int8_t      result;
+    uint8_t     reserved;
+    uint16_t    nameLen;
+} MmdReply;
+
+//======================================================================
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // MIME_MAGIC_D_HH
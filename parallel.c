@@ -0,0 +1,314 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  Speculative parallel evaluation for large buffers.
+
+    runTests() is generated as a list of segments. The first has all of
+    the cheap top-level tests. The rest share out the expensive ones, the
+    searches and regular expressions, by a rough estimate of their cost.
+    Running the segments in turn and taking the first match is the same
+    as running the whole tree.
+
+    The caller's thread runs the first segment. Most files with a magic
+    number stop there. Otherwise the other segments are offered to the
+    caller's executor and the caller works through them as well, so
+    nothing waits on a busy pool. When a segment matches, the later ones
+    are cancelled at their next top-level test since they can no longer
+    give the first match. The earlier ones carry on as one of them may
+    still match. Any far tests that were put off are run at the end, as
+    runTests() does.
+
+    Nothing is allocated. The run lives on the caller's stack and the
+    tasks reach it through one of a few static slots. A task counts
+    itself in under the slot's lock when it starts, and the caller waits
+    only for those that started. Once the caller has run out of segments
+    it closes the slot, so a task that the executor starts late, or never,
+    finds nothing there and returns. That matters when the caller is a
+    worker of the same pool, or all of the workers are in such calls, as
+    then the queued tasks can't start until the call returns. A slot
+    that is taken again may see a late task from before, which just
+    helps with the new run.
+*/
+
+//======================================================================
+
+enum
+{
+    ParallelSlots = 16,     // calls in flight at once, the rest run serially
+};
+
+typedef struct ParallelRun
+{
+    const Byte*     buf;
+    size_t          len;
+    int             next;                   // the next segment to claim
+    SegmentState    states[SegmentCount];
+    Result          results[SegmentCount];
+    MimeId          mimes[SegmentCount];
+} ParallelRun;
+
+typedef struct ParallelSlot
+{
+    int             busy;                   // taken by a call
+    ParallelRun*    run;                    // NULL once it is closed
+    int             started;                // tasks in the run
+    pthread_mutex_t lock;
+    pthread_cond_t  finished;
+} ParallelSlot;
+
+static ParallelSlot     parallelSlots[ParallelSlots];
+static pthread_once_t   parallelOnce = PTHREAD_ONCE_INIT;
+
+
+
+static void
+parallelInit()
+{
+    int i;
+
+    for (i = 0; i < ParallelSlots; ++i)
+    {
+        pthread_mutex_init(&parallelSlots[i].lock, NULL);
+        pthread_cond_init(&parallelSlots[i].finished, NULL);
+    }
+}
+
+
+
+static ParallelSlot*
+takeSlot(ParallelRun* run)
+{
+    // NULL if all of the slots are taken.
+    int i;
+
+    pthread_once(&parallelOnce, parallelInit);
+
+    for (i = 0; i < ParallelSlots; ++i)
+    {
+        ParallelSlot* slot = &parallelSlots[i];
+
+        if (__atomic_exchange_n(&slot->busy, 1, __ATOMIC_ACQUIRE) == 0)
+        {
+            pthread_mutex_lock(&slot->lock);
+            slot->run = run;
+            pthread_mutex_unlock(&slot->lock);
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+
+
+static void
+closeSlot(ParallelSlot* slot)
+{
+    // No task can join once this returns, and those that did are done.
+    pthread_mutex_lock(&slot->lock);
+    slot->run = NULL;
+
+    while (slot->started > 0)
+    {
+        pthread_cond_wait(&slot->finished, &slot->lock);
+    }
+
+    pthread_mutex_unlock(&slot->lock);
+    __atomic_store_n(&slot->busy, 0, __ATOMIC_RELEASE);
+}
+
+
+
+static int
+claimSegment(ParallelRun* run)
+{
+    int k = __atomic_fetch_add(&run->next, 1, __ATOMIC_RELAXED);
+
+    return k < SegmentCount? k : -1;
+}
+
+
+
+static void
+runSegment(ParallelRun* run, int k)
+{
+    MimeId  id = NoMime;
+    Result  r  = Fail;
+    int     j;
+
+    if (!cancelled(&run->states[k]))
+    {
+        r = segments[k](run->buf, run->len, &id, &run->states[k]);
+    }
+
+    run->results[k] = r;
+    run->mimes[k]   = id;
+
+    if (r > 0)
+    {
+        for (j = k + 1; j < SegmentCount; ++j)
+        {
+            __atomic_store_n(&run->states[j].cancel, 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+
+
+static void
+parallelTask(void* arg)
+{
+    ParallelSlot*   slot = (ParallelSlot*)arg;
+    ParallelRun*    run;
+    int             k;
+
+    pthread_mutex_lock(&slot->lock);
+    run = slot->run;
+
+    if (run)
+    {
+        ++slot->started;
+    }
+
+    pthread_mutex_unlock(&slot->lock);
+
+    if (!run)
+    {
+        return;
+    }
+
+    while ((k = claimSegment(run)) >= 0)
+    {
+        runSegment(run, k);
+    }
+
+    // The run may be gone as soon as this is counted out.
+    pthread_mutex_lock(&slot->lock);
+
+    if (--slot->started == 0)
+    {
+        pthread_cond_signal(&slot->finished);
+    }
+
+    pthread_mutex_unlock(&slot->lock);
+}
+
+
+
+static Result
+runTestsParallel(const Byte* buf, size_t len, MimeId* mime, int flags, const MimeMagicExecutor* exec)
+{
+    ParallelRun     run;
+    ParallelSlot*   slot;
+    Result          first;
+    Bool            haveError;
+    uint32_t        deferred;
+    int             want;
+    int             k;
+
+    memset(&run, 0, sizeof(run));
+
+    for (k = 0; k < SegmentCount; ++k)
+    {
+        run.states[k].flags = flags;
+    }
+
+    first = segments[0](buf, len, mime, &run.states[0]);
+
+    if (first > 0)
+    {
+        return first;
+    }
+
+    run.buf  = buf;
+    run.len  = len;
+    run.next = 1;
+    slot     = takeSlot(&run);
+
+    // The caller takes one of the segments itself.
+    want = SegmentCount > 2? SegmentCount - 2 : 0;
+
+    if (exec->threads < want)
+    {
+        want = exec->threads;
+    }
+
+    // A task that can't be submitted is done by the caller below.
+    for (k = 0; slot && k < want; ++k)
+    {
+        exec->submit(exec->context, parallelTask, slot);
+    }
+
+    while ((k = claimSegment(&run)) >= 0)
+    {
+        runSegment(&run, k);
+    }
+
+    if (slot)
+    {
+        closeSlot(slot);
+    }
+
+    // The first match in segment order wins.
+    haveError = first < 0;
+    deferred  = run.states[0].deferred;
+
+    for (k = 1; k < SegmentCount; ++k)
+    {
+        if (run.results[k] > 0)
+        {
+            *mime = run.mimes[k];
+            return Match;
+        }
+
+        if (run.results[k] < 0)
+        {
+            haveError = True;
+        }
+
+        deferred |= run.states[k].deferred;
+    }
+
+    if (deferred)
+    {
+        Result r;
+
+        run.states[0].deferred = deferred;
+        r = runDeferred(buf, len, mime, &run.states[0]);
+
+        if (r > 0)
+        {
+            return Match;
+        }
+
+        if (r < 0)
+        {
+            haveError = True;
+        }
+    }
+
+    return haveError? Error : Fail;
+}
@@ -29,8 +29,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <regex.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "mimemagic.h"
+#include "mimemagic_ids.h"
 
 //======================================================================
 
@@ -39,10 +43,29 @@ typedef uint8_t   Byte;
 typedef uint64_t  Mask;
 typedef int64_t   Int;
 typedef uint64_t  UInt;
+typedef uint16_t  MimeId;
 
 #define True  1
 #define False 0
 
+/*  The generated code marks the rare paths so that the compiler keeps
+    the common ones together. See putTestBody() in generate.py.
+*/
+#define Unlikely(x) __builtin_expect(!!(x), 0)
+#define Cold        __attribute__((cold, noinline))
+
+/*  A MIME type is identified by its index in the generated mimeNames
+    table. Id 0 means no MIME type. The first few are fixed so that the
+    hand-written code can produce them. See FixedMimes in generate.py.
+*/
+enum
+{
+    NoMime    = 0,
+    TextASCII = 1,
+    TextUTF8  = 2,
+    TextUTF16 = 3,
+};
+
 /*  This library doesn't distinguish between text and binary data.
 */
 typedef enum StringFlags
@@ -79,7 +102,8 @@ typedef struct StringMap
 {
     const char* test;
     size_t      tlen;
-    const char* mime;
+    MimeId      mime;
+    int         line;       // in the magic file
 } StringMap;
 
 
@@ -87,10 +111,25 @@ typedef struct ShortMap
 {
     int16_t     test;
     uint16_t    mask;
-    const char* mime;
+    MimeId      mime;
+    int         line;
 } ShortMap;
 
 
+/*  The 4 bytes of a carving anchor, how far they are into the file, the
+    segments with its rules and the MIME types that they can give. See
+    carve.c.
+*/
+typedef struct CarveAnchor
+{
+    uint32_t    word;       // as loaded by carveWord()
+    uint8_t     shift;      // at most CarveMaxShift
+    uint8_t     segments;   // bit n for segments[n]
+    uint16_t    first;      // in carveMimes
+    uint16_t    count;
+} CarveAnchor;
+
+
 //======================================================================
 
 /*  The result of a match is
@@ -110,7 +149,208 @@ typedef enum Result
     Match = 1,
     Fail  = 0,
     Error = -1
-} Result; 
+} Result;
+
+
+/*  A test at a negative offset counts back from the end of the file.
+    getMimeTypeHeadTail() has only the head and the tail of the file in
+    separate buffers. Without a tail the file is the buffer.
+*/
+typedef struct Tail
+{
+    const Byte* buf;
+    size_t      len;
+    size_t      size;       // of the file, which ends with the tail
+} Tail;
+
+
+/*  The tests that may read the tail work in positions in the file. They
+    read from the buffer that holds the position. See fileView().
+*/
+typedef struct View
+{
+    const Byte* buf;
+    size_t      len;
+    size_t      base;       // the position of buf in the file
+} View;
+
+
+/*  runTests() is generated as a list of segments that are run in turn.
+    A segment checks the cancel field before each of its top-level tests
+    so that a parallel run can stop it. See parallel.c.
+
+    The top-level tests at a fixed offset beyond the first page are the
+    far tests. With MimeMagicDeferFaults a far test whose page isn't
+    resident is put off and its bit is set in deferred. runDeferred()
+    runs them after all of the segments if nothing else matched.
+
+    For getMimeTypeMatch() the test that sets the MIME type records
+    itself in match. See noteMatch().
+*/
+typedef struct SegmentState
+{
+    int         cancel;
+    int         flags;      // the MimeMagicFlags of the call
+    uint32_t    deferred;   // a bit for each far test that was put off
+    int         depth;      // of indirect tests, see indirectMatch()
+    const Tail* tail;       // or NULL for the end of the buffer
+    MimeMagicMatch* match;  // or NULL
+} SegmentState;
+
+typedef Result (*Segment)(const Byte* buf, size_t len, MimeId* mime, SegmentState* state);
+
+/*  An indirect test runs the whole tree again from its offset. This
+    limits how deeply they can nest.
+*/
+enum
+{
+    MaxIndirect = 2,
+};
+
+
+
+static inline Bool
+cancelled(const SegmentState* state)
+{
+    return __atomic_load_n(&state->cancel, __ATOMIC_RELAXED) != 0;
+}
+
+
+
+static void
+noteMatch(const SegmentState* state, int line, int level, size_t start, size_t end)
+{
+    /*  This is only called once a test has set the MIME type and only if
+        the caller wants to know. The tests leave their offset at the end
+        of what they matched and return its length.
+    */
+    MimeMagicMatch* match = state->match;
+
+    match->line  = line;
+    match->depth = level;
+    match->start = start;
+    match->end   = end;
+}
+
+
+
+/*  With MIMEMAGIC_TRACE each test that runs is recorded in the ring that
+    getMimeTypeTraced() set for the calling thread. Otherwise TraceTest()
+    is nothing at all. See the trace option in the Makefile.
+*/
+#ifdef MIMEMAGIC_TRACE
+
+#include <time.h>
+
+static __thread MimeMagicTrace* traceRing;
+
+
+
+static inline uint64_t
+traceClock()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+
+
+static void
+traceTest(int line, Result rslt, size_t offset)
+{
+    MimeMagicTrace* ring = traceRing;
+
+    if (ring)
+    {
+        MimeMagicTraceEntry* e = &ring->entries[ring->count++ % ring->size];
+
+        e->line   = line;
+        e->result = rslt > 0? Match : rslt;
+        e->offset = offset;
+        e->cycles = traceClock();
+    }
+}
+
+#define TraceTest(line, rslt, offset) traceTest(line, rslt, offset)
+
+#else
+
+#define TraceTest(line, rslt, offset)
+
+#endif // MIMEMAGIC_TRACE
+
+
+
+static inline Result
+endOffset(size_t len, const SegmentState* state, size_t back, size_t* offset)
+{
+    // A file that is too short can't have the trailer.
+    size_t size = state->tail? state->tail->size : len;
+
+    if (back > size)
+    {
+        return Fail;
+    }
+
+    *offset = size - back;
+    return Match;
+}
+
+
+
+static inline View
+fileView(const Byte* buf, size_t len, const SegmentState* state, size_t pos)
+{
+    /*  A position before the tail reads the head. If it is in the gap
+        between them the test runs off the end of the head, as it would
+        with any buffer that is too short.
+    */
+    const Tail* tail = state->tail;
+    View        view = {buf, len, 0};
+
+    if (tail && pos >= tail->size - tail->len)
+    {
+        view.buf  = tail->buf;
+        view.len  = tail->len;
+        view.base = tail->size - tail->len;
+    }
+
+    return view;
+}
+
+
+
+static Bool
+deferFar(const Byte* buf, size_t len, size_t offset, SegmentState* state, int n)
+{
+    /*  Decide whether to put off far test n. If the offset is past the
+        end the test fails without touching the page so there is nothing
+        to save. If mincore() fails we can't tell so we go ahead.
+    */
+    uintptr_t       page;
+    unsigned char   resident;
+
+    if (!(state->flags & MimeMagicDeferFaults) || offset >= len)
+    {
+        return False;
+    }
+
+    page = (uintptr_t)(buf + offset) & ~(uintptr_t)(sysconf(_SC_PAGESIZE) - 1);
+
+    if (mincore((void*)page, 1, &resident) == 0 && !(resident & 1))
+    {
+        state->deferred |= (uint32_t)1 << n;
+        return True;
+    }
+
+    return False;
+}
 
 
 
@@ -126,11 +366,17 @@ stringMatch(
     )
 {
     const Byte* bp   = buf + *offset;
-    const Byte* bend = bp + len;
+    const Byte* bend = buf + len;
     const Byte* tp   = test;
     const Byte* tend = test + tlen;
     Bool        match;
 
+    // An indirect offset can be anything.
+    if (*offset >= len)
+    {
+        return Error;
+    }
+
     for (; tp < tend && bp < bend; ++bp, ++tp)
     {
         char b = *bp;
@@ -200,8 +446,10 @@ stringMatch(
 
     if (match)
     {
-        *offset += bp - buf;
-        return bp - buf;
+        Result n = bp - (buf + *offset);
+
+        *offset = bp - buf;
+        return n;
     }
 
     if (bp == bend && tp != tend || bp != bend && tp == tend)
@@ -228,11 +476,13 @@ stringSearch(
 {
     // Search for the string up to limit characters beyond the offset.
     // len - tlen is the last position at which a match is possible.
-    // Ranges are exclusive at the right.
+    // Ranges are exclusive at the right. It's only an error if the
+    // buffer cut the window short as more data might then match.
     Result  rslt;
     size_t  start = *offset;
     size_t  last;
     size_t  end = start + limit;
+    Bool    cut;
 
     if (start >= len || tlen > len)
     {
@@ -240,8 +490,9 @@ stringSearch(
     }
 
     last = len - tlen + 1;
+    cut  = end > last;
 
-    if (end >= last)
+    if (cut)
     {
         end = last;
     }
@@ -259,7 +510,118 @@ stringSearch(
         }
     }
 
-    return Error;
+    return cut? Error : Fail;
+}
+
+
+
+/*  regcomp() does a large number of memory allocations so the compiled
+    regexps are kept per thread. A thread's cache is found through a
+    thread-local pointer and it is freed by a key destructor when the
+    thread exits. The entries are keyed by the address of the pattern,
+    which is a string constant, and the flags. There are fewer patterns
+    than entries so the table never fills, but if it did we would
+    compile on each call.
+*/
+enum
+{
+    RegexCacheSize = 128,
+};
+
+typedef struct RegexEntry
+{
+    const char* pattern;
+    int         cflags;
+    int         err;
+    regex_t     compiled;
+} RegexEntry;
+
+typedef struct RegexCache
+{
+    RegexEntry  entries[RegexCacheSize];
+} RegexCache;
+
+static __thread RegexCache* regexCache;
+static pthread_once_t       regexOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t        regexKey;
+
+
+
+static void
+regexThreadExit(void* arg)
+{
+    RegexCache* cache = (RegexCache*)arg;
+    size_t      i;
+
+    for (i = 0; i < RegexCacheSize; ++i)
+    {
+        if (cache->entries[i].pattern && cache->entries[i].err == 0)
+        {
+            regfree(&cache->entries[i].compiled);
+        }
+    }
+
+    // A later call on the thread, say from another key's destructor,
+    // maps a new cache.
+    munmap(cache, sizeof(RegexCache));
+    regexCache = NULL;
+}
+
+
+
+static void
+regexInit()
+{
+    pthread_key_create(&regexKey, regexThreadExit);
+}
+
+
+
+static RegexEntry*
+regexLookup(const char* pattern, int cflags)
+{
+    // NULL if the cache can't be had.
+    size_t  h = (((uintptr_t)pattern >> 3) ^ cflags) & (RegexCacheSize - 1);
+    size_t  i;
+
+    if (!regexCache)
+    {
+        void* cache;
+
+        pthread_once(&regexOnce, regexInit);
+
+        // mmap() keeps the library clear of malloc().
+        cache = mmap(NULL, sizeof(RegexCache), PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (cache == MAP_FAILED)
+        {
+            return NULL;
+        }
+
+        regexCache = (RegexCache*)cache;
+        pthread_setspecific(regexKey, cache);
+    }
+
+    for (i = 0; i < RegexCacheSize; ++i)
+    {
+        RegexEntry* e = &regexCache->entries[(h + i) & (RegexCacheSize - 1)];
+
+        if (!e->pattern)
+        {
+            e->pattern = pattern;
+            e->cflags  = cflags;
+            e->err     = regcomp(&e->compiled, pattern, cflags);
+            return e;
+        }
+
+        if (e->pattern == pattern && e->cflags == cflags)
+        {
+            return e;
+        }
+    }
+
+    return NULL;
 }
 
 
@@ -274,43 +636,73 @@ regexMatch(
     int         flags
     )
 {
-    /*  There is only a limit if it is greater than 0.
-        Either way the data must be NUL-terminated text
-        so we make a copy.
-
-        It appears that calls to regcomp() do a large number of memory
-        allocations.  If would be tempting to cache compiled regexps
-        but that would require a context object to preserve thread
-        safety.
-
+    /*  There is only a limit if it is greater than 0. The text ends at
+        the limit or the first NUL. With REG_STARTEND the match is made
+        in place, otherwise we need a NUL-terminated copy. A failure is
+        an error if the end of the buffer cut the text short.
     */
     Result      result = Error;
-    regex_t     compiled;
+    RegexEntry* entry;
+    regex_t     local;
+    regex_t*    compiled = &local;
     regmatch_t  pmatch;
-    char*       text = 0;
     int         cflags = REG_EXTENDED | REG_NEWLINE;
     int         err;
     size_t      found = 0;
+    Bool        cut   = False;
 
     if (flags & RegexNoCase)
     {
         cflags |= REG_ICASE;
     }
-    
-    err = regcomp(&compiled, pattern, cflags);
+
+    entry = regexLookup(pattern, cflags);
+
+    if (entry)
+    {
+        err      = entry->err;
+        compiled = &entry->compiled;
+    }
+    else
+    {
+        err = regcomp(&local, pattern, cflags);
+    }
 
     if (err == 0)
     {
-        if (limit == 0 || limit > len)
+        // Only what is in the buffer after the offset.
+        size_t      avail = *offset < len ? len - *offset : 0;
+        const char* text  = (const char*)buf + *offset;
+        const char* nul;
+
+        if (limit == 0 || limit > avail)
         {
-            limit = len;
+            limit = avail;
+            cut   = True;
         }
 
-        text = malloc(limit + 1);
-        memcpy(text, buf + *offset, limit);
-        text[limit] = 0;
+        nul = memchr(text, 0, limit);
 
-        err = regexec(&compiled, text, 1, &pmatch, 0);
+        if (nul)
+        {
+            limit = nul - text;
+            cut   = False;
+        }
+
+#ifdef REG_STARTEND
+        pmatch.rm_so = 0;
+        pmatch.rm_eo = limit;
+        err = regexec(compiled, text, 1, &pmatch, REG_STARTEND);
+#else
+        {
+            char* copy = malloc(limit + 1);
+
+            memcpy(copy, text, limit);
+            copy[limit] = 0;
+            err = regexec(compiled, copy, 1, &pmatch, 0);
+            free(copy);
+        }
+#endif
 
         if (err == 0)
         {
@@ -319,16 +711,19 @@ regexMatch(
         }
         else
         {
-            result = Fail;
+            result = cut? Error : Fail;
         }
 
-        free(text);
-        regfree(&compiled);
+        if (!entry)
+        {
+            regfree(&local);
+        }
     }
 
-    if (result > 0 && !(flags & RegexBegin))
+    // The offset moves to the end of the match, or with RegexBegin to its start.
+    if (result > 0)
     {
-        *offset += found;
+        *offset += flags & RegexBegin? pmatch.rm_so : pmatch.rm_eo;
     }
 
     return result;
@@ -342,9 +737,9 @@ stringEqual(const Byte* buf, size_t len, const char* test, size_t tlen, size_t*
     // A common case. The test string may contain NUL bytes.
     size_t n = *offset;
 
-    if (n + tlen <= len)
+    if (n <= len && tlen <= len - n)
     {
-        if (tlen > 0 && buf[n] == test[0])
+        if (tlen > 0 && buf[n] == (Byte)test[0])
         {
             if (tlen == 1 || memcmp((const char*)buf + n + 1, test + 1, tlen - 1) == 0)
             {
@@ -362,7 +757,8 @@ stringEqual(const Byte* buf, size_t len, const char* test, size_t tlen, size_t*
 
 
 static Result
-stringEqualMap(const Byte* buf, size_t len, const StringMap* map, size_t mapLen, const char** mime)
+stringEqualMap(const Byte* buf, size_t len, const StringMap* map, size_t mapLen, MimeId* mime,
+               const SegmentState* state)
 {
     /*  Perform multiple equality tests and select a MIME string.
 
@@ -400,6 +796,12 @@ stringEqualMap(const Byte* buf, size_t len, const StringMap* map, size_t mapLen,
             if (memcmp((const char*)buf + 1, test + 1, tlen - 1) == 0)
             {
                 *mime = map[i].mime;
+
+                if (Unlikely(state->match != NULL))
+                {
+                    noteMatch(state, map[i].line, 0, 0, tlen);
+                }
+
                 return tlen;
             }
         }
@@ -419,7 +821,7 @@ static Result
 stringLess(const Byte* buf, size_t len, const char* test, size_t tlen, size_t* offset)
 {
     // A common case. The test string may contain NUL bytes.
-    if (*offset + tlen <= len)
+    if (*offset <= len && tlen <= len - *offset)
     {
         if (memcmp((const char*)buf + *offset, test, tlen) < 0)
         {
@@ -439,7 +841,7 @@ static Result
 stringGreater(const Byte* buf, size_t len, const char* test, size_t tlen, size_t* offset)
 {
     // A common case. The test string may contain NUL bytes.
-    if (*offset + tlen <= len)
+    if (*offset <= len && tlen <= len - *offset)
     {
         if (memcmp((const char*)buf + *offset, test, tlen) > 0)
         {
@@ -533,7 +935,7 @@ leShortMatch(const Byte* buf, size_t len, int16_t test, Compare oper, Mask mask,
 {
     size_t n = *offset;
 
-    if (len >= 2 + n)
+    if (n < len && len - n >= 2)
     {
         int16_t v = (int16_t)((buf[1 + n] << 8) + buf[0 + n]);
 
@@ -556,7 +958,7 @@ beShortMatch(const Byte* buf, size_t len, int16_t test, Compare oper, Mask mask,
 {
     size_t n = *offset;
 
-    if (len >= 2 + n)
+    if (n < len && len - n >= 2)
     {
         int16_t v = (int16_t)((buf[0 + n] << 8) + buf[1 + n]);
 
@@ -579,7 +981,7 @@ leLongMatch(const Byte* buf, size_t len, int32_t test, Compare oper, Mask mask,
 {
     size_t n = *offset;
 
-    if (len >= 4 + n)
+    if (n < len && len - n >= 4)
     {
         int32_t v = (((int32_t)buf[3 + n]) << 24) +
                     (((int32_t)buf[2 + n]) << 16) +
@@ -605,7 +1007,7 @@ beLongMatch(const Byte* buf, size_t len, int32_t test, Compare oper, Mask mask,
 {
     size_t n = *offset;
 
-    if (len >= 4 + n)
+    if (n < len && len - n >= 4)
     {
         int32_t v = (((int32_t)buf[0 + n]) << 24) +
                     (((int32_t)buf[1 + n]) << 16) +
@@ -631,7 +1033,7 @@ leQuadMatch(const Byte* buf, size_t len, int64_t test, Compare oper, Mask mask,
 {
     size_t n = *offset;
 
-    if (len >= 8 + n)
+    if (n < len && len - n >= 8)
     {
         int64_t v = (((int64_t)buf[7 + n]) << 56) +
                     (((int64_t)buf[6 + n]) << 48) +
@@ -661,7 +1063,7 @@ beQuadMatch(const Byte* buf, size_t len, int64_t test, Compare oper, Mask mask,
 {
     size_t n = *offset;
 
-    if (len >= 8 + n)
+    if (n < len && len - n >= 8)
     {
         int64_t v = (((int64_t)buf[0 + n]) << 56) +
                     (((int64_t)buf[1 + n]) << 48) +
@@ -712,7 +1114,7 @@ uleShortMatch(const Byte* buf, size_t len, uint16_t test, Compare oper, Mask mas
 {
     size_t n = *offset;
 
-    if (len >= 2 + n)
+    if (n < len && len - n >= 2)
     {
         uint16_t v = (buf[1 + n] << 8) + buf[0 + n];
 
@@ -735,7 +1137,7 @@ ubeShortMatch(const Byte* buf, size_t len, uint16_t test, Compare oper, Mask mas
 {
     size_t n = *offset;
 
-    if (len >= 2 + n)
+    if (n < len && len - n >= 2)
     {
         uint16_t v = (buf[0 + n] << 8) + buf[1 + n];
 
@@ -758,7 +1160,7 @@ uleLongMatch(const Byte* buf, size_t len, uint32_t test, Compare oper, Mask mask
 {
     size_t n = *offset;
 
-    if (len >= 4 + n)
+    if (n < len && len - n >= 4)
     {
         uint32_t v = (((uint32_t)buf[3 + n]) << 24) +
                      (((uint32_t)buf[2 + n]) << 16) +
@@ -784,7 +1186,7 @@ ubeLongMatch(const Byte* buf, size_t len, uint32_t test, Compare oper, Mask mask
 {
     size_t n = *offset;
 
-    if (len >= 4 + n)
+    if (n < len && len - n >= 4)
     {
         uint32_t v = (((uint32_t)buf[0 + n]) << 24) +
                      (((uint32_t)buf[1 + n]) << 16) +
@@ -810,7 +1212,7 @@ uleQuadMatch(const Byte* buf, size_t len, uint64_t test, Compare oper, Mask mask
 {
     size_t n = *offset;
 
-    if (len >= 8 + n)
+    if (n < len && len - n >= 8)
     {
         uint64_t v = (((uint64_t)buf[7 + n]) << 56) +
                      (((uint64_t)buf[6 + n]) << 48) +
@@ -840,7 +1242,7 @@ ubeQuadMatch(const Byte* buf, size_t len, uint64_t test, Compare oper, Mask mask
 {
     size_t n = *offset;
 
-    if (len >= 8 + n)
+    if (n < len && len - n >= 8)
     {
         uint64_t v = (((uint64_t)buf[0 + n]) << 56) +
                      (((uint64_t)buf[1 + n]) << 48) +
@@ -866,7 +1268,8 @@ ubeQuadMatch(const Byte* buf, size_t len, uint64_t test, Compare oper, Mask mask
 
 
 static Result
-beShortGroup(const Byte* buf, size_t len, const ShortMap* map, size_t mapLen, const char** mime)
+beShortGroup(const Byte* buf, size_t len, const ShortMap* map, size_t mapLen, MimeId* mime,
+             const SegmentState* state)
 {
     // Do multiple beshort tests at offset 0.
     if (len >= 2)
@@ -882,7 +1285,13 @@ beShortGroup(const Byte* buf, size_t len, const ShortMap* map, size_t mapLen, co
             if ((value & mask) == (test & mask))
             {
                 *mime = map[i].mime;
-                return Match;
+
+                if (Unlikely(state->match != NULL))
+                {
+                    noteMatch(state, map[i].line, 0, 0, 2);
+                }
+
+                return 2;
             }
         }
 
@@ -892,18 +1301,155 @@ beShortGroup(const Byte* buf, size_t len, const ShortMap* map, size_t mapLen, co
     return Error;
 }
 
+//======================================================================
+
+/*  MPEG audio has no magic number, only a sync word at the start of
+    each frame. We look for the sync within the window and decode the
+    header to find the next frame. A run of frames with the same version,
+    layer and sample rate is unlikely to be chance.
+*/
+enum
+{
+    MpegWindow = 4096,          // where the first frame may start
+    MpegFrames = 3,             // the length of run that we want
+};
 
+static const uint16_t mpegBitrates[2][3][16] = {
+    {   // MPEG 1, layers I, II and III in kbit/s
+        {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 0},
+        {0, 32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384, 0},
+        {0, 32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 0},
+    },
+    {   // MPEG 2 and 2.5
+        {0, 32, 48, 56,  64,  80,  96, 112, 128, 144, 160, 176, 192, 224, 256, 0},
+        {0,  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160, 0},
+        {0,  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160, 0},
+    },
+};
+
+static const uint16_t mpegRates[3] = {44100, 48000, 32000};
+
+
+
+static size_t
+mpegFrameLength(const Byte* h, unsigned* kind)
+{
+    /*  Decode the 4 byte frame header at h. This returns the length of
+        the frame or 0 if it isn't a valid header. The free format bit
+        rate isn't accepted as the length can't be found from the header.
+    */
+    unsigned version = (h[1] >> 3) & 3;         // 3 = 1, 2 = 2, 0 = 2.5
+    unsigned layer   = 3 - ((h[1] >> 1) & 3);   // 0 = I, 1 = II, 2 = III
+    unsigned brIndex = h[2] >> 4;
+    unsigned srIndex = (h[2] >> 2) & 3;
+    unsigned padding = (h[2] >> 1) & 1;
+    unsigned bitrate;
+    unsigned rate;
+
+    if (h[0] != 0xFF || (h[1] & 0xE0) != 0xE0 || version == 1 || layer == 3 ||
+        brIndex == 0 || brIndex == 15 || srIndex == 3 || (h[3] & 3) == 2)
+    {
+        return 0;
+    }
+
+    bitrate = mpegBitrates[version != 3][layer][brIndex] * 1000;
+    rate    = mpegRates[srIndex] >> (version == 3? 0 : version == 2? 1 : 2);
+
+    // The fields that can't change from one frame to the next.
+    *kind = ((h[1] << 8) | h[2]) & 0x1E0C;
+
+    if (layer == 0)
+    {
+        return (12 * bitrate / rate + padding) * 4;
+    }
+
+    if (layer == 2 && version != 3)
+    {
+        return 72 * bitrate / rate + padding;
+    }
+
+    return 144 * bitrate / rate + padding;
+}
+
+
+
+static Result
+mpegFrames(const Byte* buf, size_t len, size_t* offset)
+{
+    /*  The sync can start anywhere in the window after the offset. The
+        0xFF bytes are found with memchr() which is vectorised in the C
+        library. Most of them are rejected at the next byte. On a match
+        the offset is left after the header of the first frame.
+    */
+    const Byte* p   = buf + *offset;
+    const Byte* end;
+    Bool        cut = False;
+
+    if (*offset >= len)
+    {
+        return Error;
+    }
+
+    end = len - *offset > MpegWindow? p + MpegWindow : buf + len;
+
+    while ((p = memchr(p, 0xFF, end - p)) != NULL)
+    {
+        size_t   at = p - buf;
+        size_t   n;
+        unsigned first = 0;
+
+        for (n = 0; n < MpegFrames; ++n)
+        {
+            unsigned kind;
+            size_t   flen;
+
+            if (at + 4 > len)
+            {
+                cut = True;
+                break;
+            }
+
+            flen = mpegFrameLength(buf + at, &kind);
+
+            if (flen == 0 || (n > 0 && kind != first))
+            {
+                break;
+            }
+
+            first = kind;
+            at   += flen;
+        }
+
+        if (n == MpegFrames)
+        {
+            *offset = p - buf + 4;
+            return 4;
+        }
+
+        ++p;
+    }
+
+    // A longer buffer might have a sync later in the window or the
+    // rest of a run.
+    return (cut || len - *offset < MpegWindow)? Error : Fail;
+}
+
+//======================================================================
 
 static Result
 getOffset(const Byte* buf, size_t len, size_t at, char type, size_t* offset)
 {
-    /*  Fetch an indirect offset. We only implement 'bslBSL'. These
-        are the only ones in use in the magic these days. The only use of .I
-        is for 'SGI SoundTrack project file' which doesn't map to a MIME that
-        we use.
+    /*  Fetch an indirect offset. We only implement 'bslBSLI'. These
+        are the only ones in use in the magic these days. The .I is for the
+        ID3 tag in front of an MP3 file.
     */
     UInt   v = 0;
 
+    if (at >= len)
+    {
+        return Error;
+    }
+
     switch (type)
     {
     case 'b':
@@ -935,6 +1481,59 @@ getOffset(const Byte* buf, size_t len, size_t at, char type, size_t* offset)
         if (at + 4 >= len) return Error;
         v = (buf[at] << 24) + (buf[at + 1] << 16) + (buf[at + 2] << 8) + buf[at + 3];
         break;
+
+    case 'I':
+        // An ID3 size: big endian with 7 bits in each byte. As in libmagic
+        // it counts from the end of the 10 byte header.
+        if (at + 4 >= len) return Error;
+        v = (buf[at] & 0x7f) << 21 | (buf[at + 1] & 0x7f) << 14 |
+            (buf[at + 2] & 0x7f) << 7 | (buf[at + 3] & 0x7f);
+        v += 10;
+        break;
+    }
+
+    *offset = v;
+    return Match;
+}
+
+
+
+static Result
+offsetArith(size_t* offset, char op, long long operand)
+{
+    /*  Apply the operator of an indirect offset such as (68.l-1). An
+        offset that would go below 0 or past SIZE_MAX is in no input, so
+        the test fails rather than asking for more data.
+    */
+    size_t v = *offset;
+
+    if (op == '-')
+    {
+        op      = '+';
+        operand = -operand;
+    }
+
+    switch (op)
+    {
+    case '+':
+        if (operand < 0? v < (size_t)-operand : v > SIZE_MAX - (size_t)operand) return Fail;
+        v += operand;
+        break;
+
+    case '*':
+        if (operand < 0 || (operand > 0 && v > SIZE_MAX / (size_t)operand)) return Fail;
+        v *= operand;
+        break;
+
+    case '/':
+    case '%':
+        if (operand <= 0) return Fail;
+        v = (op == '/')? v / operand : v % operand;
+        break;
+
+    case '&': v &= operand; break;
+    case '|': v |= operand; break;
+    case '^': v ^= operand; break;
     }
 
     *offset = v;
@@ -0,0 +1,354 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  A CPython extension module for Python 2.7 and 3. The data is taken
+    with the buffer protocol so that bytes, bytearray, memoryview, mmap
+    and numpy arrays are classified in place without a copy. The GIL is
+    released while classifying so other Python threads can run.
+
+    get_mime_types() classifies a list of buffers on several threads. All
+    of the buffers are acquired first with the GIL held. The threads
+    then work with no Python objects at all.
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "mimemagic.h"
+
+//======================================================================
+
+/*  Below this many buffers per thread it isn't worth starting one.
+*/
+static const Py_ssize_t MinPerThread = 16;
+
+typedef struct Item
+{
+    Py_buffer   view;
+    const char* mime;
+    int         result;
+} Item;
+
+
+typedef struct Slice
+{
+    Item*       items;
+    Py_ssize_t  count;
+    int         flags;
+} Slice;
+
+
+
+static PyObject*
+mimeToPython(int result, const char* mime)
+{
+    if (result > 0)
+    {
+#if PY_MAJOR_VERSION >= 3
+        return PyUnicode_FromString(mime);
+#else
+        return PyString_FromString(mime);
+#endif
+    }
+
+    Py_RETURN_NONE;
+}
+
+
+
+/*  In Python 2 some types, such as mmap, only have the old buffer
+    interface.
+*/
+static int
+getBuffer(PyObject* obj, Py_buffer* view)
+{
+#if PY_MAJOR_VERSION < 3
+    const void* ptr;
+    Py_ssize_t  len;
+
+    if (!PyObject_CheckBuffer(obj) && PyObject_CheckReadBuffer(obj))
+    {
+        if (PyObject_AsReadBuffer(obj, &ptr, &len) < 0)
+        {
+            return -1;
+        }
+
+        return PyBuffer_FillInfo(view, obj, (void*)ptr, len, 1, PyBUF_SIMPLE);
+    }
+#endif
+
+    return PyObject_GetBuffer(obj, view, PyBUF_SIMPLE);
+}
+
+
+
+static void
+classifySlice(Slice* s)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < s->count; ++i)
+    {
+        Item* it = &s->items[i];
+
+        it->mime   = NULL;
+        it->result = getMimeType(it->view.buf, it->view.len, &it->mime, s->flags);
+    }
+}
+
+
+
+static void*
+sliceThread(void* arg)
+{
+    classifySlice((Slice*)arg);
+    return NULL;
+}
+
+//======================================================================
+
+PyDoc_STRVAR(getMimeTypeDoc,
+"get_mime_type(buffer, flags=0) -> str or None\n\n"
+"Return the MIME type of the data in any contiguous buffer, or None if\n"
+"it isn't recognised. The flags are as for getMimeType(), for example\n"
+"NO_TRY_TEXT. The data isn't copied and the GIL is released.");
+
+static PyObject*
+pyGetMimeType(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    static char* keywords[] = {"buffer", "flags", NULL};
+
+    PyObject*   obj;
+    Py_buffer   view;
+    const char* mime  = NULL;
+    int         flags = 0;
+    int         r;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|i:get_mime_type", keywords, &obj, &flags))
+    {
+        return NULL;
+    }
+
+    if (getBuffer(obj, &view) < 0)
+    {
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    r = getMimeType(view.buf, view.len, &mime, flags);
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&view);
+    return mimeToPython(r, mime);
+}
+
+
+
+PyDoc_STRVAR(getMimeTypesDoc,
+"get_mime_types(buffers, flags=0, threads=0) -> list\n\n"
+"Classify each buffer in a sequence, as for get_mime_type(), and return\n"
+"a list of the results. The work is spread over up to threads threads,\n"
+"by default one per CPU. Small batches are done on the calling thread.");
+
+static PyObject*
+pyGetMimeTypes(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    static char* keywords[] = {"buffers", "flags", "threads", NULL};
+
+    PyObject*   seq;
+    PyObject*   fast;
+    PyObject*   result = NULL;
+    Item*       items;
+    Slice*      slices;
+    pthread_t*  tids;
+    Py_ssize_t  count;
+    Py_ssize_t  acquired;
+    Py_ssize_t  i;
+    int         flags   = 0;
+    int         threads = 0;
+    int         started = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|ii:get_mime_types", keywords,
+                                     &seq, &flags, &threads))
+    {
+        return NULL;
+    }
+
+    fast = PySequence_Fast(seq, "get_mime_types() needs a sequence of buffers");
+
+    if (!fast)
+    {
+        return NULL;
+    }
+
+    count = PySequence_Fast_GET_SIZE(fast);
+
+    if (threads <= 0)
+    {
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+
+    if (threads > count / MinPerThread)
+    {
+        threads = count / MinPerThread;
+    }
+
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+
+    items  = (Item*)PyMem_Malloc((count ? count : 1) * sizeof(Item));
+    slices = (Slice*)PyMem_Malloc(threads * sizeof(Slice));
+    tids   = (pthread_t*)PyMem_Malloc(threads * sizeof(pthread_t));
+
+    if (!items || !slices || !tids)
+    {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    for (acquired = 0; acquired < count; ++acquired)
+    {
+        PyObject* obj = PySequence_Fast_GET_ITEM(fast, acquired);
+
+        if (getBuffer(obj, &items[acquired].view) < 0)
+        {
+            goto release;
+        }
+    }
+
+    for (i = 0; i < threads; ++i)
+    {
+        Py_ssize_t first = count * i / threads;
+
+        slices[i].items = items + first;
+        slices[i].count = count * (i + 1) / threads - first;
+        slices[i].flags = flags;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+
+    // The calling thread does the first slice itself.
+    for (started = 1; started < threads; ++started)
+    {
+        if (pthread_create(&tids[started], NULL, sliceThread, &slices[started]) != 0)
+        {
+            break;
+        }
+    }
+
+    classifySlice(&slices[0]);
+
+    for (i = started; i < threads; ++i)
+    {
+        classifySlice(&slices[i]);
+    }
+
+    for (i = 1; i < started; ++i)
+    {
+        pthread_join(tids[i], NULL);
+    }
+
+    Py_END_ALLOW_THREADS
+
+    result = PyList_New(count);
+
+    for (i = 0; result && i < count; ++i)
+    {
+        PyObject* m = mimeToPython(items[i].result, items[i].mime);
+
+        if (!m)
+        {
+            Py_CLEAR(result);
+            break;
+        }
+
+        PyList_SET_ITEM(result, i, m);
+    }
+
+release:
+    for (i = 0; i < acquired; ++i)
+    {
+        PyBuffer_Release(&items[i].view);
+    }
+
+done:
+    PyMem_Free(items);
+    PyMem_Free(slices);
+    PyMem_Free(tids);
+    Py_DECREF(fast);
+    return result;
+}
+
+//======================================================================
+
+static PyMethodDef methods[] = {
+    {"get_mime_type",  (PyCFunction)pyGetMimeType,  METH_VARARGS | METH_KEYWORDS, getMimeTypeDoc},
+    {"get_mime_types", (PyCFunction)pyGetMimeTypes, METH_VARARGS | METH_KEYWORDS, getMimeTypesDoc},
+    {NULL, NULL, 0, NULL}
+};
+
+PyDoc_STRVAR(moduleDoc, "Recognise the MIME type of data in a buffer with libmimemagic.");
+
+#if PY_MAJOR_VERSION >= 3
+
+static struct PyModuleDef moduleDef = {
+    PyModuleDef_HEAD_INIT, "mimemagic", moduleDoc, -1, methods
+};
+
+PyMODINIT_FUNC
+PyInit_mimemagic(void)
+{
+    PyObject* m = PyModule_Create(&moduleDef);
+
+    if (m)
+    {
+        PyModule_AddIntConstant(m, "NO_TRY_TEXT", MimeMagicNoTryText);
+        PyModule_AddIntConstant(m, "DEFER_FAULTS", MimeMagicDeferFaults);
+    }
+
+    return m;
+}
+
+#else
+
+PyMODINIT_FUNC
+initmimemagic(void)
+{
+    PyObject* m = Py_InitModule3("mimemagic", methods, moduleDoc);
+
+    if (m)
+    {
+        PyModule_AddIntConstant(m, "NO_TRY_TEXT", MimeMagicNoTryText);
+        PyModule_AddIntConstant(m, "DEFER_FAULTS", MimeMagicDeferFaults);
+    }
+}
+
+#endif
@@ -0,0 +1,31 @@
+#!/usr/bin/python
+
+#   Build the mimemagic extension module. Build the library first with
+#   make in the directory above, then:
+#
+#       python setup.py build_ext --inplace
+#
+#   The archive library is compiled with -fpic so it is linked straight
+#   into the module, which then has no dependency on libmimemagic.so.
+
+try:
+    from setuptools import setup, Extension
+except ImportError:
+    from distutils.core import setup, Extension
+
+module = Extension(
+    'mimemagic',
+    sources         = ['mimemagicmodule.c'],
+    include_dirs    = ['..'],
+    extra_objects   = ['../libmimemagic.a'],
+    extra_compile_args = ['-std=gnu99'],
+    libraries       = ['pthread'],
+    )
+
+setup(
+    name        = 'mimemagic',
+    version     = '0.2',
+    description = 'Recognise the MIME type of data in a buffer',
+    license     = 'BSD',
+    ext_modules = [module],
+    )
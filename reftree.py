@@ -0,0 +1,255 @@
+
+"""
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+"""
+
+import utils
+from utils import mkIndent
+from utils import OStream
+
+from generate import Generate
+
+#   This is a module for compile.py. It writes the pruned test tree as a
+#   table of nodes for the reference interpreter in tests/refmagic.c.
+#
+#   It inherits the ordering and grouping decisions of Generate so
+#   that the nodes come out in the order that the generated code tests
+#   them. Each entry of a beshort group or string map becomes its own
+#   node. The interpreter walks the table with the same primitives from
+#   prologue.c, so any difference from the generated code is a bug in
+#   one of the code generators.
+
+RefNodesFile = "tests/refnodes.h"
+
+#======================================================================
+
+class RefTree(Generate):
+    stringKinds = {
+        '=':    'NodeStringEqual',
+        '=!':   'NodeStringNotEqual',
+        '<':    'NodeStringLess',
+        '<!':   'NodeStringNotLess',
+        '>':    'NodeStringGreater',
+        '>!':   'NodeStringNotGreater'
+        }
+
+    intKinds = {
+        'byte':     'NodeByte',
+        'beshort':  'NodeBeShort',
+        'belong':   'NodeBeLong',
+        'bequad':   'NodeBeQuad',
+        'leshort':  'NodeLeShort',
+        'lelong':   'NodeLeLong',
+        'lequad':   'NodeLeQuad'
+        }
+
+
+    def __init__(self):
+        Generate.__init__(self)
+
+        # A list of dicts of C initialisers in the order of evaluation.
+        self.nodes = []
+
+
+    def putRoot(self, root):
+        self.assignMimeIds(root)
+        self.putTests(root.subtests, 1)
+
+
+    def addNode(self, test, kind, fields):
+        # Add the node and then its subtests, which follow it in the table.
+        node = {
+            '.kind':    kind,
+            '.line':    str(test.lnum),
+            '.level':   str(test.level),
+            }
+        node.update(fields)
+
+        if test.setMime:
+            node['.mime'] = self.mimeRef(test.setMime)
+
+        self.nodes.append(node)
+
+        if not test.setMime:
+            self.putTests(test.subtests, test.level + 1)
+
+        node['.end'] = str(len(self.nodes))
+
+
+    def offsetFields(self, test):
+        # The same parts of the offset that genOffset() uses.
+        off = test.offset
+        fields = {'.offset': off.offset}
+
+        if self.fromEnd(off):
+            fields['.offset']  = off.offset[1:]
+            fields['.fromEnd'] = 'True'
+
+        if self.inTail(test):
+            fields['.inTail'] = 'True'
+
+        if self.readsTail(test):
+            fields['.readsTail'] = 'True'
+
+        if off.outerRelative:
+            fields['.outerRelative'] = 'True'
+
+        if off.indirect:
+            fields['.indirect'] = 'True'
+            fields['.typeFlag'] = "'%s'" % off.typeFlag
+
+            if off.innerRelative:
+                fields['.innerRelative'] = 'True'
+
+            if off.operand:
+                fields['.oper']    = "'%s'" % off.operator
+                fields['.operand'] = off.operand
+
+        return fields
+
+
+    def targetFields(self, targ):
+        return {'.target': targ, '.tlen': 'sizeof(%s) - 1' % targ}
+
+
+    def putBeShortGroup(self, tests, level):
+        for t in tests:
+            mask = '0xffff' if t.testMask == None else t.testMask
+            self.addNode(t, 'NodeShortGroup', {'.value': t.target, '.mask': mask})
+
+
+    def putStringMap(self, tests, level):
+        # In the same order as the map so that the first match is the same.
+        entries = [(utils.splitStringBytes(t.target), t) for t in tests]
+        entries.sort(key = lambda pair: pair[0])
+
+        for (bytes, t) in entries:
+            fields = self.targetFields(utils.bytesToC(bytes))
+            self.addNode(t, 'NodeStringMapEntry', fields)
+
+
+    def putSimpleString(self, test, level):
+        if test.targetOper in self.stringKinds:
+            fields = self.offsetFields(test)
+            fields.update(self.targetFields(utils.quoteForC(test.target)))
+            self.addNode(test, self.stringKinds[test.targetOper], fields)
+
+        elif test.targetOper == 'x':
+            self.addNode(test, 'NodeAlways', {})
+
+
+    def putGeneralTest(self, test, level):
+        # Mirrors Generate.putGeneralTest(). Anything that isn't
+        # generated there is left out here too, with its subtests.
+        code = test.testCode
+
+        if code == 'indirect':
+            self.addNode(test, 'NodeIndirect', self.offsetFields(test))
+
+        elif code == 'mpegframes':
+            self.addNode(test, 'NodeMpegFrames', self.offsetFields(test))
+
+        elif code == 'default' or test.targetOper == 'x':
+            self.addNode(test, 'NodeAlways', {})
+
+        elif code == 'string':
+            flags = ['0']
+            if 'w' in test.testFlags: flags.append('IgnoreWS')
+            if 'W' in test.testFlags: flags.append('CompactWS')
+            if 'c' in test.testFlags: flags.append('MatchLower')
+            if 'C' in test.testFlags: flags.append('MatchUpper')
+
+            oper = []
+            if '=' in test.targetOper: oper.append('CompareEq')
+            if '<' in test.targetOper: oper.append('CompareLt')
+            if '>' in test.targetOper: oper.append('CompareGt')
+            if '!' in test.targetOper: oper.append('CompareNot')
+
+            fields = self.offsetFields(test)
+            fields.update(self.targetFields(utils.quoteForC(test.target)))
+            fields['.flags']   = '|'.join(flags)
+            fields['.compare'] = '|'.join(oper) if oper else '0'
+            self.addNode(test, 'NodeStringMatch', fields)
+
+        elif code == 'search':
+            if test.testLimit != None:
+                flags = ['0']
+                if 'w' in test.testFlags: flags.append('IgnoreWS')
+                if 'W' in test.testFlags: flags.append('CompactWS')
+                if 'c' in test.testFlags: flags.append('MatchLower')
+                if 'C' in test.testFlags: flags.append('MatchUpper')
+
+                fields = self.offsetFields(test)
+                fields.update(self.targetFields(utils.quoteForC(test.target)))
+                fields['.flags'] = '|'.join(flags)
+                fields['.limit'] = test.testLimit
+                self.addNode(test, 'NodeSearch', fields)
+
+        elif code == 'regex':
+            limit = test.testLimit if test.testLimit != None else '0'
+
+            flags = ['0']
+            if 'c' in test.testFlags: flags.append('RegexNoCase')
+            if 's' in test.testFlags: flags.append('RegexBegin')
+            if 'l' in test.testFlags: limit += ' * 80'
+
+            fields = self.offsetFields(test)
+            fields.update(self.targetFields(utils.quoteForC(test.target)))
+            fields['.flags'] = '|'.join(flags)
+            fields['.limit'] = limit
+            self.addNode(test, 'NodeRegex', fields)
+
+        elif code in self.intKinds:
+            fields = self.offsetFields(test)
+            fields['.value']   = test.target
+            fields['.compare'] = self.genCompareCodes(test)
+            fields['.mask']    = test.testMask if test.testMask else "0xffffffff"
+            self.addNode(test, self.intKinds[code], fields)
+
+
+    def writeToFile(self, path):
+        out  = open(path, "w")
+        ind1 = mkIndent(1)
+
+        print >> out, "/*  This file is generated by compile.py for refmagic.c. Don't edit it."
+        print >> out, "*/"
+
+        self.putMimeNames(out)
+
+        print >> out, "\nstatic const Node refNodes[] = {"
+
+        order = ['.kind', '.line', '.level', '.end', '.mime',
+                 '.offset', '.fromEnd', '.inTail', '.readsTail',
+                 '.outerRelative', '.indirect', '.innerRelative',
+                 '.typeFlag', '.oper', '.operand',
+                 '.target', '.tlen', '.value', '.compare', '.mask', '.limit', '.flags']
+
+        for node in self.nodes:
+            parts = ["%s = %s" % (k, node[k]) for k in order if k in node]
+            print >> out, "%s{%s}," % (ind1, ", ".join(parts))
+
+        print >> out, "};"
+        print >> out, "static const size_t refNodeCount = %d;" % len(self.nodes)
+        out.close()
@@ -0,0 +1,497 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  Optional sampling of the inputs, see mimeMagicSampleStart(). This is
+    only compiled in when MIMEMAGIC_SAMPLE is defined. See the sample
+    option in the Makefile.
+
+    Each thread counts down to its next sample so a call that isn't
+    sampled costs a load and a decrement. The gaps are random with a mean
+    of the rate so that a periodic pattern in the traffic isn't aliased.
+
+    A sampled call copies the start of its input into a ring owned by its
+    thread. The thread is the only writer of the head and the flushing
+    thread the only writer of the tail, so neither takes a lock. When the
+    ring is full the sample is dropped rather than wait. The rings are
+    mapped rather than malloc()ed, as for the statistics. A thread's ring
+    is replaced when sampling is restarted with a different size and is
+    freed by the flushing thread once it has been drained.
+*/
+
+//======================================================================
+
+#ifdef MIMEMAGIC_SAMPLE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <time.h>
+
+enum
+{
+    SampleSlots   = 64,             // per thread
+    SampleFlushMs = 100,
+};
+
+
+typedef struct SampleSlot
+{
+    MimeMagicSample record;
+    MimeId          mime;
+    Byte            data[];
+} SampleSlot;
+
+
+typedef struct SampleRing
+{
+    struct SampleRing* next;
+    unsigned        generation;     // of mimeMagicSampleStart()
+    size_t          bytes;          // of the input in a slot
+    size_t          slotSize;
+    size_t          mapped;
+    Bool            dead;           // no longer written, free once drained
+    unsigned        head;           // written by the owning thread
+    unsigned        tail;           // written by the flushing thread
+    Byte            slots[] __attribute__((aligned(64)));
+} SampleRing;
+
+
+static pthread_mutex_t  sampleLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   sampleWake = PTHREAD_COND_INITIALIZER;
+static pthread_once_t   sampleOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t    sampleKey;
+static pthread_t        sampleThread;
+static Bool             sampleRunning;
+static SampleRing*      sampleRings;
+static int              sampleFd = -1;
+static unsigned         sampleRate;         // 0 when not sampling
+static unsigned         sampleGeneration;
+static size_t           sampleBytes;
+static uint64_t         sampleDropped;
+
+static __thread SampleRing* myRing;
+static __thread uint32_t    sampleCountdown;
+static __thread uint32_t    sampleSeed;
+
+
+
+static inline uint64_t
+sampleClock()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+
+static uint32_t
+sampleGap(unsigned rate)
+{
+    // A gap from 1 to 2 * rate - 1 by xorshift.
+    uint32_t x = sampleSeed;
+
+    if (x == 0)
+    {
+        x = (uint32_t)(uintptr_t)&sampleSeed ^ (uint32_t)sampleClock();
+        x = x? x : 1;
+    }
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sampleSeed = x;
+
+    return 1 + (uint32_t)(x % (2 * (uint64_t)rate - 1));
+}
+
+
+
+static inline Bool
+sampleDue()
+{
+    unsigned rate = __atomic_load_n(&sampleRate, __ATOMIC_RELAXED);
+
+    if (rate == 0)
+    {
+        return False;
+    }
+
+    // A new thread starts at a random point in a gap.
+    if (sampleCountdown == 0)
+    {
+        sampleCountdown = sampleGap(rate);
+    }
+
+    if (--sampleCountdown > 0)
+    {
+        return False;
+    }
+
+    sampleCountdown = sampleGap(rate);
+    return True;
+}
+
+
+
+static void
+sampleFree(SampleRing* ring)
+{
+    // With sampleLock held.
+    SampleRing** pp;
+
+    for (pp = &sampleRings; *pp; pp = &(*pp)->next)
+    {
+        if (*pp == ring)
+        {
+            *pp = ring->next;
+            break;
+        }
+    }
+
+    munmap(ring, ring->mapped);
+}
+
+
+
+static void
+sampleThreadExit(void* arg)
+{
+    SampleRing* ring = arg;
+
+    pthread_mutex_lock(&sampleLock);
+
+    if (sampleRunning)
+    {
+        ring->dead = True;
+    }
+    else
+    {
+        sampleFree(ring);
+    }
+
+    pthread_mutex_unlock(&sampleLock);
+}
+
+
+
+static void
+sampleInit()
+{
+    pthread_key_create(&sampleKey, sampleThreadExit);
+}
+
+
+
+static SampleRing*
+sampleForThread(unsigned generation)
+{
+    SampleRing* ring;
+    size_t      bytes    = __atomic_load_n(&sampleBytes, __ATOMIC_RELAXED);
+    size_t      slotSize = (sizeof(SampleSlot) + bytes + 63) & ~(size_t)63;
+    size_t      mapped   = sizeof(SampleRing) + SampleSlots * slotSize;
+
+    pthread_once(&sampleOnce, sampleInit);
+
+    ring = mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (ring == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    ring->generation = generation;
+    ring->bytes      = bytes;
+    ring->slotSize   = slotSize;
+    ring->mapped     = mapped;
+
+    pthread_mutex_lock(&sampleLock);
+
+    // The old ring is left for the flushing thread to drain.
+    if (myRing)
+    {
+        if (sampleRunning)
+        {
+            myRing->dead = True;
+        }
+        else
+        {
+            sampleFree(myRing);
+        }
+    }
+
+    ring->next  = sampleRings;
+    sampleRings = ring;
+    pthread_mutex_unlock(&sampleLock);
+
+    pthread_setspecific(sampleKey, ring);
+    myRing = ring;
+    return ring;
+}
+
+
+
+static void
+sampleRecord(const Byte* buf, size_t len, const Tail* tail, Result r, MimeId mime, int flags, uint64_t ns)
+{
+    SampleRing* ring       = myRing;
+    unsigned    generation = __atomic_load_n(&sampleGeneration, __ATOMIC_RELAXED);
+    SampleSlot* slot;
+    unsigned    head;
+
+    if (!ring || ring->generation != generation)
+    {
+        if (!(ring = sampleForThread(generation)))
+        {
+            return;
+        }
+    }
+
+    head = ring->head;
+
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= SampleSlots)
+    {
+        __atomic_fetch_add(&sampleDropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    slot = (SampleSlot*)(ring->slots + (head % SampleSlots) * ring->slotSize);
+
+    slot->record.length      = tail? tail->size : len;
+    slot->record.nanoseconds = ns;
+    slot->record.result      = r;
+    slot->record.flags       = flags;
+    slot->record.bytes       = len < ring->bytes? len : ring->bytes;
+    slot->mime               = r > 0? mime : NoMime;
+    memcpy(slot->data, buf, slot->record.bytes);
+
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+
+
+static void
+sampleWrite(const SampleSlot* slot)
+{
+    // A short write is given up on. The file then ends with a partial
+    // record, which a reader should ignore.
+    MimeMagicSample record = slot->record;
+    const char*     mime   = mimeNames[slot->mime];
+    struct iovec    iov[3];
+    ssize_t         n;
+
+    record.mimeLen = mime? strlen(mime) : 0;
+
+    iov[0].iov_base = &record;
+    iov[0].iov_len  = sizeof(record);
+    iov[1].iov_base = (void*)mime;
+    iov[1].iov_len  = record.mimeLen;
+    iov[2].iov_base = (void*)slot->data;
+    iov[2].iov_len  = record.bytes;
+
+    do
+    {
+        n = writev(sampleFd, iov, 3);
+    }
+    while (n < 0 && errno == EINTR);
+}
+
+
+
+static void
+sampleDrain()
+{
+    // With sampleLock held.
+    SampleRing* ring;
+    SampleRing* next;
+
+    for (ring = sampleRings; ring; ring = next)
+    {
+        unsigned head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        unsigned t;
+
+        next = ring->next;
+
+        for (t = ring->tail; t != head; ++t)
+        {
+            sampleWrite((const SampleSlot*)(ring->slots + (t % SampleSlots) * ring->slotSize));
+        }
+
+        __atomic_store_n(&ring->tail, head, __ATOMIC_RELEASE);
+
+        if (ring->dead)
+        {
+            sampleFree(ring);
+        }
+    }
+}
+
+
+
+static void*
+sampleFlusher(void* arg)
+{
+    struct timespec when;
+
+    (void)arg;
+    pthread_mutex_lock(&sampleLock);
+
+    while (sampleRunning)
+    {
+        clock_gettime(CLOCK_REALTIME, &when);
+        when.tv_nsec += SampleFlushMs * 1000000L;
+
+        if (when.tv_nsec >= 1000000000L)
+        {
+            when.tv_sec  += 1;
+            when.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait(&sampleWake, &sampleLock, &when);
+        sampleDrain();
+    }
+
+    pthread_mutex_unlock(&sampleLock);
+    return NULL;
+}
+
+#endif // MIMEMAGIC_SAMPLE
+
+
+
+int
+mimeMagicSampleStart(const char* path, unsigned int rate, size_t bytes)
+{
+#ifdef MIMEMAGIC_SAMPLE
+    static const char magic[8] = "MMSAMPL1";
+    SampleRing* ring;
+    int         fd;
+
+    if (rate == 0)
+    {
+        return -1;
+    }
+
+    if (bytes == 0)
+    {
+        bytes = MimeMagicSampleBytes;
+    }
+
+    if (bytes > MimeMagicSampleMaxBytes)
+    {
+        bytes = MimeMagicSampleMaxBytes;
+    }
+
+    pthread_mutex_lock(&sampleLock);
+
+    if (sampleRunning)
+    {
+        pthread_mutex_unlock(&sampleLock);
+        return -1;
+    }
+
+    fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+    if (fd < 0)
+    {
+        pthread_mutex_unlock(&sampleLock);
+        return -1;
+    }
+
+    if (lseek(fd, 0, SEEK_END) == 0 && write(fd, magic, sizeof(magic)) != sizeof(magic))
+    {
+        close(fd);
+        pthread_mutex_unlock(&sampleLock);
+        return -1;
+    }
+
+    // Anything left over from an earlier run is discarded.
+    for (ring = sampleRings; ring; ring = ring->next)
+    {
+        __atomic_store_n(&ring->tail, __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    }
+
+    sampleFd      = fd;
+    sampleRunning = True;
+    __atomic_store_n(&sampleDropped, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&sampleBytes, bytes, __ATOMIC_RELAXED);
+
+    if (pthread_create(&sampleThread, NULL, sampleFlusher, NULL) != 0)
+    {
+        sampleRunning = False;
+        sampleFd      = -1;
+        close(fd);
+        pthread_mutex_unlock(&sampleLock);
+        return -1;
+    }
+
+    // A ring of the old size is replaced at its thread's next sample.
+    __atomic_add_fetch(&sampleGeneration, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&sampleRate, rate, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&sampleLock);
+    return 0;
+#else
+    (void)path;
+    (void)rate;
+    (void)bytes;
+    return -1;
+#endif
+}
+
+
+
+unsigned long long
+mimeMagicSampleStop(void)
+{
+#ifdef MIMEMAGIC_SAMPLE
+    pthread_mutex_lock(&sampleLock);
+
+    if (!sampleRunning)
+    {
+        pthread_mutex_unlock(&sampleLock);
+        return 0;
+    }
+
+    __atomic_store_n(&sampleRate, 0, __ATOMIC_RELAXED);
+    sampleRunning = False;
+    pthread_cond_signal(&sampleWake);
+    pthread_mutex_unlock(&sampleLock);
+
+    pthread_join(sampleThread, NULL);
+
+    // The flushing thread has gone so this is the last drain.
+    pthread_mutex_lock(&sampleLock);
+    sampleDrain();
+    close(sampleFd);
+    sampleFd = -1;
+    pthread_mutex_unlock(&sampleLock);
+
+    return __atomic_load_n(&sampleDropped, __ATOMIC_RELAXED);
+#else
+    return 0;
+#endif
+}
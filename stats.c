@@ -0,0 +1,613 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  Optional run-time statistics. This is only compiled in when
+    MIMEMAGIC_STATS is defined. See the stats option in the Makefile.
+
+    Each thread records into its own block of counters so that the
+    calls never share a cache line or take a lock. The blocks are only
+    locked when a thread first records, when it exits and when a snapshot
+    merges them. A snapshot may see a call half recorded, for example
+    counted but not yet added to the histogram. That is fine for metrics.
+*/
+
+//======================================================================
+
+#ifdef MIMEMAGIC_STATS
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <sys/mman.h>
+#include <time.h>
+
+/*  A growing string for rendering the snapshot.
+*/
+typedef struct StrBuf
+{
+    char*   text;
+    size_t  len;
+    size_t  size;
+    Bool    failed;
+} StrBuf;
+
+
+
+static void
+strAppend(StrBuf* sb, const char* fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+static void
+strAppend(StrBuf* sb, const char* fmt, ...)
+{
+    va_list ap;
+    int     n;
+
+    if (sb->failed)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        size_t avail = sb->size - sb->len;
+
+        va_start(ap, fmt);
+        n = vsnprintf(sb->text + sb->len, avail, fmt, ap);
+        va_end(ap);
+
+        if (n < 0)
+        {
+            sb->failed = True;
+            return;
+        }
+
+        if ((size_t)n < avail)
+        {
+            sb->len += n;
+            return;
+        }
+
+        {
+            size_t size = 2 * sb->size + n + 1;
+            char*  text = malloc(size);
+
+            if (!text)
+            {
+                sb->failed = True;
+                return;
+            }
+
+            if (sb->text)
+            {
+                memcpy(text, sb->text, sb->len + 1);
+                free(sb->text);
+            }
+            sb->text = text;
+            sb->size = size;
+        }
+    }
+}
+
+
+
+static void
+strAppendQuoted(StrBuf* sb, const char* s)
+{
+    // Both JSON strings and Prometheus labels escape \ and " this way.
+    strAppend(sb, "\"");
+
+    for (; *s; ++s)
+    {
+        if (*s == '"' || *s == '\\')
+        {
+            strAppend(sb, "\\%c", *s);
+        }
+        else
+        {
+            strAppend(sb, "%c", *s);
+        }
+    }
+
+    strAppend(sb, "\"");
+}
+
+//======================================================================
+
+/*  Latencies go into log-linear buckets in the style of an HDR histogram.
+    Each power of two of nanoseconds is split into StatSubBuckets so the
+    bucket width is at most 25% of its value. The last bucket collects
+    anything over about 18 minutes.
+*/
+enum
+{
+    StatSubBits    = 2,
+    StatSubBuckets = 1 << StatSubBits,
+    StatBuckets    = 40 * StatSubBuckets,
+};
+
+
+typedef enum Outcome
+{
+    OutcomeMatch = 0,   // runTests() found a MIME type
+    OutcomeFail,        // nothing found
+    OutcomeError,       // nothing found but more data might help
+    OutcomeText,        // found by the plain text fallback
+    OutcomeCount
+} Outcome;
+
+
+static const char* const outcomeNames[OutcomeCount] = {
+    "match", "fail", "error", "text"
+};
+
+
+typedef struct ThreadStats
+{
+    struct ThreadStats* next;
+    uint64_t    calls[OutcomeCount];
+    uint64_t    sumNs[OutcomeCount];
+    uint64_t    hist[OutcomeCount][StatBuckets];
+    uint64_t    mimeCalls[MimeCount];
+    uint64_t    mimeNs[MimeCount];
+} ThreadStats;
+
+
+static pthread_mutex_t  statsLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t   statsOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t    statsKey;
+static ThreadStats*     statsLive;      // the threads that have recorded
+static ThreadStats      statsRetired;   // totals from threads that have exited
+static __thread ThreadStats* myStats;
+static double           statsNsPerTick = 1;   // see statsCalibrate()
+
+
+
+static inline uint64_t
+statsClock()
+{
+    // As traceClock(), the time stamp counter where there is one. A
+    // clock_gettime() pair costs more than a fast call itself.
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+
+
+static uint64_t
+statsMonotonic()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+
+static void
+statsCalibrate()
+{
+    // Time the counter against the monotonic clock for about a
+    // millisecond, once for the process.
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t ns0    = statsMonotonic();
+    uint64_t ticks0 = statsClock();
+    uint64_t ns;
+
+    do
+    {
+        ns = statsMonotonic();
+    }
+    while (ns - ns0 < 1000000);
+
+    statsNsPerTick = (double)(ns - ns0) / (double)(statsClock() - ticks0);
+#endif
+}
+
+
+
+static inline unsigned
+statsBucket(uint64_t ns)
+{
+    unsigned msb;
+    unsigned b;
+
+    if (ns < StatSubBuckets)
+    {
+        return ns;
+    }
+
+    msb = 63 - __builtin_clzll(ns);
+    b   = (msb - StatSubBits + 1) * StatSubBuckets +
+          ((ns >> (msb - StatSubBits)) & (StatSubBuckets - 1));
+
+    return b < StatBuckets? b : StatBuckets - 1;
+}
+
+
+
+static uint64_t
+statsBucketLimit(unsigned b)
+{
+    // The exclusive upper bound of the bucket, in nanoseconds.
+    unsigned group = b / StatSubBuckets;
+    unsigned sub   = b % StatSubBuckets;
+    unsigned msb;
+
+    if (group == 0)
+    {
+        return b + 1;
+    }
+
+    msb = group + StatSubBits - 1;
+    return ((uint64_t)1 << msb) + (sub + (uint64_t)1) * ((uint64_t)1 << (msb - StatSubBits));
+}
+
+
+
+static inline void
+statsAdd(uint64_t* counter, uint64_t n)
+{
+    // Only the owning thread writes so a plain add is enough. The
+    // store must not tear as a snapshot may be reading it.
+    __atomic_store_n(counter, *counter + n, __ATOMIC_RELAXED);
+}
+
+
+
+static inline uint64_t
+statsGet(const uint64_t* counter)
+{
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+
+
+static void
+statsMerge(ThreadStats* to, const ThreadStats* from)
+{
+    size_t i;
+    size_t b;
+
+    for (i = 0; i < OutcomeCount; ++i)
+    {
+        to->calls[i] += statsGet(&from->calls[i]);
+        to->sumNs[i] += statsGet(&from->sumNs[i]);
+
+        for (b = 0; b < StatBuckets; ++b)
+        {
+            to->hist[i][b] += statsGet(&from->hist[i][b]);
+        }
+    }
+
+    for (i = 0; i < MimeCount; ++i)
+    {
+        to->mimeCalls[i] += statsGet(&from->mimeCalls[i]);
+        to->mimeNs[i]    += statsGet(&from->mimeNs[i]);
+    }
+}
+
+
+
+static void
+statsThreadExit(void* arg)
+{
+    // Fold the thread's counts into the retired totals.
+    ThreadStats*  ts = arg;
+    ThreadStats** pp;
+
+    pthread_mutex_lock(&statsLock);
+
+    for (pp = &statsLive; *pp; pp = &(*pp)->next)
+    {
+        if (*pp == ts)
+        {
+            *pp = ts->next;
+            break;
+        }
+    }
+
+    statsMerge(&statsRetired, ts);
+    pthread_mutex_unlock(&statsLock);
+
+    // A later call on the thread, say from another key's destructor,
+    // maps a new block.
+    munmap(ts, sizeof(ThreadStats));
+    myStats = NULL;
+}
+
+
+
+static void
+statsInit()
+{
+    pthread_key_create(&statsKey, statsThreadExit);
+    statsCalibrate();
+}
+
+
+
+static ThreadStats*
+statsForThread()
+{
+    /*  The block is mapped rather than malloc()ed so that it is page
+        aligned and can't share a cache line with anything else.
+    */
+    ThreadStats* ts;
+
+    pthread_once(&statsOnce, statsInit);
+
+    ts = mmap(NULL, sizeof(ThreadStats), PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (ts == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&statsLock);
+    ts->next  = statsLive;
+    statsLive = ts;
+    pthread_mutex_unlock(&statsLock);
+
+    pthread_setspecific(statsKey, ts);
+    myStats = ts;
+    return ts;
+}
+
+
+
+static void
+statsRecord(Result r, Bool text, MimeId mime, uint64_t ticks)
+{
+    ThreadStats* ts = myStats;
+    Outcome      outcome;
+    uint64_t     ns;
+
+    if (!ts && !(ts = statsForThread()))
+    {
+        return;
+    }
+
+    ns = (uint64_t)(ticks * statsNsPerTick);
+
+    if (r > 0)
+    {
+        outcome = text? OutcomeText : OutcomeMatch;
+    }
+    else
+    {
+        outcome = r == 0? OutcomeFail : OutcomeError;
+    }
+
+    statsAdd(&ts->calls[outcome], 1);
+    statsAdd(&ts->sumNs[outcome], ns);
+    statsAdd(&ts->hist[outcome][statsBucket(ns)], 1);
+
+    if (r > 0)
+    {
+        statsAdd(&ts->mimeCalls[mime], 1);
+        statsAdd(&ts->mimeNs[mime], ns);
+    }
+}
+
+
+
+static void
+statsPrometheus(StrBuf* sb, const ThreadStats* all)
+{
+    size_t   i;
+    unsigned b;
+
+    strAppend(sb, "# HELP mimemagic_calls_total Calls to getMimeType() by outcome.\n");
+    strAppend(sb, "# TYPE mimemagic_calls_total counter\n");
+
+    for (i = 0; i < OutcomeCount; ++i)
+    {
+        strAppend(sb, "mimemagic_calls_total{outcome=\"%s\"} %llu\n",
+                  outcomeNames[i], (unsigned long long)all->calls[i]);
+    }
+
+    strAppend(sb, "# HELP mimemagic_latency_seconds Latency of getMimeType() by outcome.\n");
+    strAppend(sb, "# TYPE mimemagic_latency_seconds histogram\n");
+
+    for (i = 0; i < OutcomeCount; ++i)
+    {
+        const uint64_t* hist  = all->hist[i];
+        uint64_t        total = 0;
+        unsigned        top   = 0;
+
+        for (b = 0; b < StatBuckets; ++b)
+        {
+            if (hist[b])
+            {
+                top = b + 1;
+            }
+        }
+
+        /*  Only the buckets in use up to the highest, and the empty one
+            before each as it is the lower bound of the one in use. The
+            rest add nothing to a cumulative histogram.
+        */
+        for (b = 0; b < top; ++b)
+        {
+            total += hist[b];
+
+            if (hist[b] || hist[b + 1])
+            {
+                strAppend(sb, "mimemagic_latency_seconds_bucket{outcome=\"%s\",le=\"%.9g\"} %llu\n",
+                          outcomeNames[i], (statsBucketLimit(b) - 1) / 1e9,
+                          (unsigned long long)total);
+            }
+        }
+
+        strAppend(sb, "mimemagic_latency_seconds_bucket{outcome=\"%s\",le=\"+Inf\"} %llu\n",
+                  outcomeNames[i], (unsigned long long)all->calls[i]);
+        strAppend(sb, "mimemagic_latency_seconds_sum{outcome=\"%s\"} %.9g\n",
+                  outcomeNames[i], all->sumNs[i] / 1e9);
+        strAppend(sb, "mimemagic_latency_seconds_count{outcome=\"%s\"} %llu\n",
+                  outcomeNames[i], (unsigned long long)all->calls[i]);
+    }
+
+    strAppend(sb, "# HELP mimemagic_results_total Recognised MIME types.\n");
+    strAppend(sb, "# TYPE mimemagic_results_total counter\n");
+
+    for (i = 1; i < MimeCount; ++i)
+    {
+        if (all->mimeCalls[i])
+        {
+            strAppend(sb, "mimemagic_results_total{mime=");
+            strAppendQuoted(sb, mimeNames[i]);
+            strAppend(sb, "} %llu\n", (unsigned long long)all->mimeCalls[i]);
+        }
+    }
+
+    strAppend(sb, "# HELP mimemagic_result_seconds_total Time spent recognising each MIME type.\n");
+    strAppend(sb, "# TYPE mimemagic_result_seconds_total counter\n");
+
+    for (i = 1; i < MimeCount; ++i)
+    {
+        if (all->mimeCalls[i])
+        {
+            strAppend(sb, "mimemagic_result_seconds_total{mime=");
+            strAppendQuoted(sb, mimeNames[i]);
+            strAppend(sb, "} %.9g\n", all->mimeNs[i] / 1e9);
+        }
+    }
+}
+
+
+
+static void
+statsJSON(StrBuf* sb, const ThreadStats* all)
+{
+    size_t   i;
+    unsigned b;
+    Bool     first;
+
+    strAppend(sb, "{\"outcomes\": {");
+
+    for (i = 0; i < OutcomeCount; ++i)
+    {
+        strAppend(sb, "%s\n  \"%s\": {\"calls\": %llu, \"sum_ns\": %llu, \"buckets\": [",
+                  i? "," : "", outcomeNames[i],
+                  (unsigned long long)all->calls[i], (unsigned long long)all->sumNs[i]);
+
+        // Only the buckets in use, as [upper bound ns, count] pairs.
+        first = True;
+
+        for (b = 0; b < StatBuckets; ++b)
+        {
+            if (all->hist[i][b])
+            {
+                strAppend(sb, "%s[%llu, %llu]", first? "" : ", ",
+                          (unsigned long long)statsBucketLimit(b),
+                          (unsigned long long)all->hist[i][b]);
+                first = False;
+            }
+        }
+
+        strAppend(sb, "]}");
+    }
+
+    strAppend(sb, "\n},\n\"mimes\": {");
+    first = True;
+
+    for (i = 1; i < MimeCount; ++i)
+    {
+        if (all->mimeCalls[i])
+        {
+            strAppend(sb, "%s\n  ", first? "" : ",");
+            strAppendQuoted(sb, mimeNames[i]);
+            strAppend(sb, ": {\"calls\": %llu, \"sum_ns\": %llu}",
+                      (unsigned long long)all->mimeCalls[i],
+                      (unsigned long long)all->mimeNs[i]);
+            first = False;
+        }
+    }
+
+    strAppend(sb, "\n}}\n");
+}
+
+#endif // MIMEMAGIC_STATS
+
+
+
+char*
+mimeMagicStatsSnapshot(int format)
+{
+#ifdef MIMEMAGIC_STATS
+    ThreadStats*        all;
+    const ThreadStats*  ts;
+    StrBuf              sb = {0};
+
+    // This is too big for the stack of some threads.
+    all = calloc(1, sizeof(ThreadStats));
+
+    if (!all)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&statsLock);
+
+    statsMerge(all, &statsRetired);
+
+    for (ts = statsLive; ts; ts = ts->next)
+    {
+        statsMerge(all, ts);
+    }
+
+    pthread_mutex_unlock(&statsLock);
+
+    if (format == MimeMagicStatsJSON)
+    {
+        statsJSON(&sb, all);
+    }
+    else
+    {
+        statsPrometheus(&sb, all);
+    }
+
+    free(all);
+
+    if (sb.failed)
+    {
+        free(sb.text);
+        return NULL;
+    }
+
+    return sb.text;
+#else
+    return NULL;
+#endif
+}
@@ -0,0 +1,230 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+//======================================================================
+
+static const char* const counterNames[CounterCount] = {
+    "cycles",
+    "instructions",
+    "branch-misses",
+    "L1i-misses",
+    "iTLB-misses",
+    "task-clock-ns",
+};
+
+#ifdef __linux__
+
+#define CACHE_READ_MISS(cache) \
+    ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const struct
+{
+    uint32_t    type;
+    uint64_t    config;
+} counterEvents[CounterCount] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_L1I)},
+    {PERF_TYPE_HW_CACHE, CACHE_READ_MISS(PERF_COUNT_HW_CACHE_ITLB)},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+};
+
+
+typedef struct CounterRead
+{
+    uint64_t    value;
+    uint64_t    enabled;
+    uint64_t    running;
+} CounterRead;
+
+
+
+static int
+openEvent(uint32_t type, uint64_t config, int group)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.disabled       = group < 0;    // the leader starts the group
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+#endif // __linux__
+
+
+
+int
+countersOpen(Counters* ctrs)
+{
+    int n = 0;
+    int i;
+
+    ctrs->leader = -1;
+
+    for (i = 0; i < CounterCount; ++i)
+    {
+        ctrs->fds[i]    = -1;
+        ctrs->values[i] = 0;
+
+#ifdef __linux__
+        /*  Put them all in one group so that they count over the same
+            period. If the group can't be scheduled with another member
+            then that member is left out.
+        */
+        ctrs->fds[i] = openEvent(counterEvents[i].type, counterEvents[i].config, ctrs->leader);
+
+        if (ctrs->fds[i] >= 0)
+        {
+            if (ctrs->leader < 0)
+            {
+                ctrs->leader = ctrs->fds[i];
+            }
+            ++n;
+        }
+#endif
+    }
+
+    return n;
+}
+
+
+
+void
+countersClose(Counters* ctrs)
+{
+    int i;
+
+    for (i = 0; i < CounterCount; ++i)
+    {
+        if (ctrs->fds[i] >= 0)
+        {
+            close(ctrs->fds[i]);
+            ctrs->fds[i] = -1;
+        }
+    }
+
+    ctrs->leader = -1;
+}
+
+
+
+void
+countersStart(Counters* ctrs)
+{
+#ifdef __linux__
+    if (ctrs->leader >= 0)
+    {
+        ioctl(ctrs->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(ctrs->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+
+
+void
+countersStop(Counters* ctrs)
+{
+#ifdef __linux__
+    int i;
+
+    if (ctrs->leader < 0)
+    {
+        return;
+    }
+
+    ioctl(ctrs->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    for (i = 0; i < CounterCount; ++i)
+    {
+        CounterRead rd;
+
+        ctrs->values[i] = 0;
+
+        if (ctrs->fds[i] >= 0 && read(ctrs->fds[i], &rd, sizeof(rd)) == sizeof(rd))
+        {
+            // Scale up if the group was multiplexed with other events.
+            if (rd.running > 0 && rd.running < rd.enabled)
+            {
+                rd.value = (uint64_t)((double)rd.value * rd.enabled / rd.running);
+            }
+
+            ctrs->values[i] = rd.value;
+        }
+    }
+#endif
+}
+
+
+
+void
+countersReport(const Counters* ctrs, const char* label, size_t calls)
+{
+    int i;
+
+    printf("%s:", label);
+
+    for (i = 0; i < CounterCount; ++i)
+    {
+        if (ctrs->fds[i] >= 0)
+        {
+            printf(" %s %.1f", counterNames[i], (double)ctrs->values[i] / calls);
+        }
+        else
+        {
+            printf(" %s n/a", counterNames[i]);
+        }
+    }
+
+    if (ctrs->fds[CounterInstructions] >= 0 && ctrs->fds[CounterCycles] >= 0 &&
+        ctrs->values[CounterCycles] > 0)
+    {
+        printf(" IPC %.2f", (double)ctrs->values[CounterInstructions] / ctrs->values[CounterCycles]);
+    }
+
+    printf(" per call\n");
+}
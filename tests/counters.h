@@ -0,0 +1,78 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+#ifndef COUNTERS_HH
+#define COUNTERS_HH
+
+#include <stdint.h>
+#include <stddef.h>
+
+//======================================================================
+
+/*  Hardware performance counters for the benchmarks, read with
+    perf_event_open() on Linux.  A counter that the CPU or the kernel
+    doesn't provide, for example in a VM or with a high
+    perf_event_paranoid setting, is reported as n/a.
+*/
+
+typedef enum CounterKind
+{
+    CounterCycles = 0,
+    CounterInstructions,
+    CounterBranchMisses,
+    CounterL1iMisses,
+    CounterITLBMisses,
+    CounterTaskClock,           // nanoseconds, a software counter
+    CounterCount
+} CounterKind;
+
+
+typedef struct Counters
+{
+    int         fds[CounterCount];      // -1 if not available
+    int         leader;                 // the group leader fd or -1
+    uint64_t    values[CounterCount];   // the last measurement
+} Counters;
+
+
+/*  Open the counters for the calling thread. Returns the number that
+    are available.
+*/
+extern int  countersOpen(Counters* ctrs);
+extern void countersClose(Counters* ctrs);
+
+/*  Zero and start the counters, stop them and fetch the values.
+*/
+extern void countersStart(Counters* ctrs);
+extern void countersStop(Counters* ctrs);
+
+/*  Print the values from the last measurement divided by the number of calls.
+*/
+extern void countersReport(const Counters* ctrs, const char* label, size_t calls);
+
+//======================================================================
+
+#endif // COUNTERS_HH
@@ -0,0 +1,88 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  Check the C++ interface against getMimeType() for each file.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "mimemagic.hpp"
+
+using namespace mimemagic;
+
+// The ids are compile time constants.
+static_assert(id::text_plain_charset_US_ASCII == 1, "the fixed ids");
+
+static constexpr bool
+isText(MimeId m)
+{
+    switch (m)
+    {
+    case id::text_plain_charset_US_ASCII:
+    case id::text_plain_charset_UTF_8:
+    case id::text_plain_charset_UTF_16:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static_assert(isText(id::text_plain_charset_UTF_8) && !isText(id::application_pdf), "constexpr ids");
+
+
+
+int
+main(int argc, char** argv)
+{
+    int bad = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream               in(argv[i], std::ios::binary);
+        std::vector<unsigned char>  data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        const char*                 mime = nullptr;
+        int                         r = getMimeType(data.data(), data.size(), &mime, MimeMagicNone);
+
+        auto m = detect(std::as_bytes(std::span(data)));
+
+        if (m.has_value() != (r > 0) || (m && name(*m) != mime))
+        {
+            std::printf("Failed: %s, %s not %s\n", argv[i], m ? name(*m).data() : "none", r > 0 ? mime : "none");
+            ++bad;
+        }
+        else
+        {
+            std::printf("Passed: %s: %s\n", argv[i], m ? name(*m).data() : "none");
+        }
+    }
+
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,548 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  A differential fuzzer. Each input is given to the reference
+    interpreter in refmagic.c and to each of the compiled backends. Any
+    difference in the result or the mime type is a bug. The input is
+    minimised and saved.
+
+    Built with -DLIBFUZZER this is a libFuzzer target and a divergence
+    aborts. Otherwise it is a standalone program that mutates the seed
+    files itself, or with -1 just checks each file once, which suits
+    AFL with @@.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <pthread.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mimemagic.h"
+#include "refmagic.h"
+
+//======================================================================
+
+typedef unsigned char Byte;
+
+typedef int (*Backend)(const Byte* buf, size_t len, const char** mime, int flags);
+
+static int parallelMimeType(const Byte* buf, size_t len, const char** mime, int flags);
+static int batchMimeType(const Byte* buf, size_t len, const char** mime, int flags);
+static int headTailMimeType(const Byte* buf, size_t len, const char** mime, int flags);
+static int refHeadTailMimeType(const Byte* buf, size_t len, const char** mime, int flags);
+
+/*  Add new backends here as they appear. Each is checked against its
+    reference.
+*/
+static const struct
+{
+    const char* name;
+    Backend     fn;
+    Backend     ref;
+} backends[] = {
+    {"getMimeType", getMimeType, refMimeType},
+    {"getMimeTypeParallel", parallelMimeType, refMimeType},
+    {"getMimeTypeBatch", batchMimeType, refMimeType},
+    {"getMimeTypeHeadTail", headTailMimeType, refHeadTailMimeType},
+};
+
+static const size_t numBackends = sizeof(backends) / sizeof(backends[0]);
+
+enum
+{
+    MaxInput = 1 << 16,
+};
+
+//======================================================================
+
+/*  A crude executor with a detached thread for each task. The threshold
+    of 1 makes every input take the parallel path.
+*/
+typedef struct Task
+{
+    void  (*fn)(void* arg);
+    void*   arg;
+} Task;
+
+
+
+static void*
+taskThread(void* arg)
+{
+    Task task = *(Task*)arg;
+
+    free(arg);
+    task.fn(task.arg);
+    return NULL;
+}
+
+
+
+static int
+spawnTask(void* context, void (*fn)(void* arg), void* arg)
+{
+    pthread_t       tid;
+    pthread_attr_t  attr;
+    Task*           task = (Task*)malloc(sizeof(Task));
+    int             err;
+
+    task->fn  = fn;
+    task->arg = arg;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    err = pthread_create(&tid, &attr, taskThread, task);
+    pthread_attr_destroy(&attr);
+
+    if (err != 0)
+    {
+        free(task);
+    }
+
+    return err;
+}
+
+
+
+static int
+parallelMimeType(const Byte* buf, size_t len, const char** mime, int flags)
+{
+    static const MimeMagicExecutor exec = {spawnTask, NULL, 4};
+
+    return getMimeTypeParallel(buf, len, mime, flags, &exec, 1);
+}
+
+/*  The input goes last in a batch. The others are shorter copies of it
+    so that a mix up of the entries would show.
+*/
+static int
+batchMimeType(const Byte* buf, size_t len, const char** mime, int flags)
+{
+    enum { Count = 16 };
+
+    const Byte*     bufs[Count];
+    size_t          lens[Count];
+    const char*     mimes[Count];
+    int             results[Count];
+    int             i;
+
+    for (i = 0; i < Count; ++i)
+    {
+        size_t cut = Count - 1 - i;
+
+        bufs[i] = buf;
+        lens[i] = len > cut? len - cut : len;
+    }
+
+    getMimeTypeBatch(bufs, lens, Count, mimes, results, flags);
+    *mime = mimes[Count - 1];
+    return results[Count - 1];
+}
+
+/*  The first half and the last quarter of the input, as if the middle
+    of a large file wasn't fetched. The reference is given the same.
+*/
+static int
+headTailMimeType(const Byte* buf, size_t len, const char** mime, int flags)
+{
+    return getMimeTypeHeadTail(buf, len / 2, buf + len - len / 4, len / 4, len, mime, flags);
+}
+
+
+
+static int
+refHeadTailMimeType(const Byte* buf, size_t len, const char** mime, int flags)
+{
+    return refMimeTypeHeadTail(buf, len / 2, buf + len - len / 4, len / 4, len, mime, flags);
+}
+
+//======================================================================
+
+static int
+sign(int r)
+{
+    return (r > 0) - (r < 0);
+}
+
+
+
+/*  Returns the index of the first backend that differs from its
+    reference, or -1 if they all agree.
+*/
+static int
+diverges(const Byte* buf, size_t len)
+{
+    size_t      i;
+
+    for (i = 0; i < numBackends; ++i)
+    {
+        const char* want;
+        const char* got;
+        int         r = backends[i].ref(buf, len, &want, 0);
+        int         s = backends[i].fn(buf, len, &got, 0);
+
+        if (sign(s) != sign(r))
+        {
+            return i;
+        }
+
+        if (s > 0 && strcmp(got, want) != 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+
+
+static void
+report(FILE* out, const Byte* buf, size_t len, int which)
+{
+    const char* want = NULL;
+    const char* got  = NULL;
+    int         r    = backends[which].ref(buf, len, &want, 0);
+    int         s    = backends[which].fn(buf, len, &got, 0);
+
+    fprintf(out, "%zu bytes: reference %d %s, %s %d %s\n",
+            len, r, want ? want : "-", backends[which].name, s, got ? got : "-");
+}
+
+//======================================================================
+
+#ifdef LIBFUZZER
+
+int
+LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    int which = diverges(data, size);
+
+    if (which >= 0)
+    {
+        report(stderr, data, size, which);
+        abort();
+    }
+
+    return 0;
+}
+
+#else
+
+//======================================================================
+
+static void
+usage()
+{
+    fprintf(stderr, "Usage: fuzz_diff [-n iterations] [-s seed] [-o DIR] FILE...\n"
+                    "       fuzz_diff -1 FILE...\n");
+}
+
+
+
+static Byte*
+readfile(const char* path, size_t* len)
+{
+    struct stat st;
+    Byte*   buf;
+    int     fd;
+
+    fd = open(path, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) < 0)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    *len = st.st_size > MaxInput ? MaxInput : st.st_size;
+    buf  = (Byte*)malloc(*len + 1);
+
+    if (read(fd, buf, *len) < 0)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    close(fd);
+    return buf;
+}
+
+
+
+/*  This is a simple delta debugging. Try removing ever smaller chunks
+    while it still diverges, then try zeroing each remaining byte to
+    make the interesting ones stand out.
+*/
+static size_t
+minimise(Byte* buf, size_t len)
+{
+    Byte*   tmp = (Byte*)malloc(len + 1);
+    size_t  chunk;
+    size_t  i;
+
+    for (chunk = len / 2; chunk > 0; chunk /= 2)
+    {
+        i = 0;
+
+        while (i + chunk <= len)
+        {
+            memcpy(tmp, buf, i);
+            memcpy(tmp + i, buf + i + chunk, len - i - chunk);
+
+            if (len > chunk && diverges(tmp, len - chunk) >= 0)
+            {
+                len -= chunk;
+                memcpy(buf, tmp, len);
+            }
+            else
+            {
+                i += chunk;
+            }
+        }
+    }
+
+    for (i = 0; i < len; ++i)
+    {
+        Byte b = buf[i];
+
+        if (b != 0)
+        {
+            buf[i] = 0;
+
+            if (diverges(buf, len) < 0)
+            {
+                buf[i] = b;
+            }
+        }
+    }
+
+    free(tmp);
+    return len;
+}
+
+
+
+static void
+save(const char* dir, int num, const Byte* buf, size_t len)
+{
+    char    path[1024];
+    FILE*   out;
+
+    snprintf(path, sizeof(path), "%s/divergence-%d.bin", dir, num);
+    out = fopen(path, "wb");
+
+    if (!out)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    fwrite(buf, 1, len, out);
+    fclose(out);
+
+    printf("saved %s: ", path);
+    report(stdout, buf, len, diverges(buf, len));
+}
+
+
+
+/*  One random change: flip some bits, insert bytes, truncate or splice
+    in part of another seed. Magic numbers live near the start so we
+    favour small offsets.
+*/
+static size_t
+mutate(Byte* buf, size_t len, Byte** seeds, size_t* lens, int numSeeds)
+{
+    size_t  pos = len ? (random() % 2 ? random() % len : random() % (len < 64 ? len : 64)) : 0;
+    size_t  n;
+
+    switch (random() % 4)
+    {
+    case 0:
+        if (len > 0)
+        {
+            buf[pos] ^= 1 << (random() % 8);
+        }
+        break;
+
+    case 1:
+        n = 1 + random() % 8;
+
+        if (len + n <= MaxInput)
+        {
+            size_t i;
+
+            memmove(buf + pos + n, buf + pos, len - pos);
+
+            for (i = 0; i < n; ++i)
+            {
+                buf[pos + i] = random() % 4 ? (Byte)random() : "<#!%PK\n "[random() % 8];
+            }
+
+            len += n;
+        }
+        break;
+
+    case 2:
+        len = pos;
+        break;
+
+    case 3:
+        {
+            int     s = random() % numSeeds;
+            size_t  from = lens[s] ? random() % lens[s] : 0;
+
+            n = lens[s] - from;
+
+            if (pos + n > MaxInput)
+            {
+                n = MaxInput - pos;
+            }
+
+            memcpy(buf + pos, seeds[s] + from, n);
+
+            if (pos + n > len)
+            {
+                len = pos + n;
+            }
+        }
+        break;
+    }
+
+    return len;
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+    const char* outDir = ".";
+    long        iterations = 100000;
+    unsigned    seed = 1;
+    int         once = 0;
+    int         found = 0;
+    int         numSeeds;
+    Byte**      seeds;
+    size_t*     lens;
+    Byte*       buf;
+    long        n;
+    int         ch;
+    int         i;
+
+    while ((ch = getopt(argc, argv, "1n:o:s:")) != -1)
+    {
+        switch (ch)
+        {
+        case '1':
+            once = 1;
+            break;
+
+        case 'n':
+            iterations = atol(optarg);
+            break;
+
+        case 'o':
+            outDir = optarg;
+            break;
+
+        case 's':
+            seed = atoi(optarg);
+            break;
+
+        default:
+            usage();
+            exit(1);
+        }
+    }
+
+    numSeeds = argc - optind;
+
+    if (numSeeds == 0)
+    {
+        usage();
+        exit(1);
+    }
+
+    seeds = (Byte**)malloc(numSeeds * sizeof(Byte*));
+    lens  = (size_t*)malloc(numSeeds * sizeof(size_t));
+    buf   = (Byte*)malloc(MaxInput + 1);
+
+    for (i = 0; i < numSeeds; ++i)
+    {
+        seeds[i] = readfile(argv[optind + i], &lens[i]);
+
+        if (diverges(seeds[i], lens[i]) >= 0)
+        {
+            printf("%s: ", argv[optind + i]);
+            report(stdout, seeds[i], lens[i], diverges(seeds[i], lens[i]));
+            ++found;
+        }
+    }
+
+    if (once)
+    {
+        return found ? 1 : 0;
+    }
+
+    srandom(seed);
+
+    for (n = 0; n < iterations && !found; ++n)
+    {
+        int     s = random() % numSeeds;
+        size_t  len = lens[s];
+        int     k = 1 + random() % 4;
+
+        memcpy(buf, seeds[s], len);
+
+        while (k-- > 0)
+        {
+            len = mutate(buf, len, seeds, lens, numSeeds);
+        }
+
+        if (diverges(buf, len) >= 0)
+        {
+            len = minimise(buf, len);
+            save(outDir, found++, buf, len);
+        }
+    }
+
+    if (!found)
+    {
+        printf("fuzz_diff: %ld inputs, no divergence\n", n);
+    }
+
+    return found ? 1 : 0;
+}
+
+#endif // LIBFUZZER
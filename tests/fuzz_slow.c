@@ -0,0 +1,546 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  A fuzzer that looks for inputs that make getMimeType() slow rather
+    than ones that crash it. The library is compiled into this program
+    with -fsanitize-coverage=trace-pc so that every basic block calls
+    __sanitizer_cov_trace_pc() below. That gives us both the edges for
+    coverage, as in AFL, and the number of blocks executed, which is our
+    measure of cost. Unlike a time it doesn't depend on the machine or
+    the load.
+
+    An input is kept when it reaches new edges or it is the slowest so
+    far for its result. At the end the slowest are written to the output
+    directory as slowNN.bin for the regression corpus.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mimemagic.h"
+
+//======================================================================
+
+typedef unsigned char Byte;
+
+enum
+{
+    MapSize  = 1 << 14,
+    PopSize  = 256,
+};
+
+static uint8_t      edges[MapSize];
+static uint8_t      virgin[MapSize];
+static uintptr_t    prevBlock;
+static uint64_t     blocks;
+
+
+
+void
+__sanitizer_cov_trace_pc(void)
+{
+    uintptr_t pc  = (uintptr_t)__builtin_return_address(0);
+    size_t    idx = ((pc ^ (pc >> 15)) ^ prevBlock) & (MapSize - 1);
+
+    ++edges[idx];
+    prevBlock = (pc ^ (pc >> 15)) >> 1;
+    ++blocks;
+}
+
+
+
+static uint8_t
+bucket(uint8_t count)
+{
+    // AFL's hit count classes, so that looping more counts as new.
+    if (count <= 3)   return count;
+    if (count <= 7)   return 8;
+    if (count <= 15)  return 16;
+    if (count <= 31)  return 32;
+    if (count <= 127) return 64;
+    return 128;
+}
+
+
+
+/*  Returns the cost in blocks. newEdges is set if the input reached an
+    edge or a count class not seen before.
+*/
+static uint64_t
+run(const Byte* buf, size_t len, int* newEdges, const char** mime)
+{
+    size_t i;
+
+    memset(edges, 0, sizeof(edges));
+    prevBlock = 0;
+    blocks    = 0;
+
+    *mime = NULL;
+    getMimeType(buf, len, mime, MimeMagicNone);
+
+    *newEdges = 0;
+
+    for (i = 0; i < MapSize; ++i)
+    {
+        if (edges[i])
+        {
+            uint8_t b = bucket(edges[i]);
+
+            if (!(virgin[i] & b))
+            {
+                virgin[i] |= b;
+                *newEdges = 1;
+            }
+        }
+    }
+
+    return blocks;
+}
+
+//======================================================================
+
+typedef struct Entry
+{
+    Byte*       buf;
+    size_t      len;
+    uint64_t    cost;
+    const char* mime;
+} Entry;
+
+static Entry    population[PopSize];
+static size_t   popCount;
+
+static Entry*   slowest;
+static size_t   numSlowest;
+static size_t   maxLen = 16384;
+
+
+
+static void
+setEntry(Entry* e, const Byte* buf, size_t len, uint64_t cost)
+{
+    e->buf  = (Byte*)realloc(e->buf, len + 1);
+    e->len  = len;
+    e->cost = cost;
+    memcpy(e->buf, buf, len);
+}
+
+
+
+static void
+addToPopulation(const Byte* buf, size_t len, uint64_t cost)
+{
+    // When full, replace an entry at random.
+    size_t i = popCount < PopSize ? popCount++ : (size_t)random() % PopSize;
+
+    setEntry(&population[i], buf, len, cost);
+}
+
+
+
+static int
+compareCost(const void* a, const void* b)
+{
+    // Slowest first with the empty slots last.
+    const Entry* x = (const Entry*)a;
+    const Entry* y = (const Entry*)b;
+
+    return (x->cost < y->cost) - (x->cost > y->cost);
+}
+
+
+
+/*  We keep the slowest input for each result so that one slow path
+    doesn't crowd out the rest. Returns true if it made it slower.
+*/
+static int
+addToSlowest(const Byte* buf, size_t len, uint64_t cost, const char* mime)
+{
+    Entry*  e = NULL;
+    size_t  i;
+
+    mime = mime ? mime : "unrecognised";
+
+    for (i = 0; i < numSlowest && slowest[i].buf; ++i)
+    {
+        if (strcmp(slowest[i].mime, mime) == 0)
+        {
+            e = &slowest[i];
+            break;
+        }
+    }
+
+    if (!e)
+    {
+        // A new result takes an empty slot or else the cheapest.
+        e = &slowest[i < numSlowest ? i : numSlowest - 1];
+
+        if (e->buf && e->cost >= cost)
+        {
+            return 0;
+        }
+    }
+    else
+    if (cost < e->cost || (cost == e->cost && len >= e->len))
+    {
+        return 0;
+    }
+
+    setEntry(e, buf, len, cost);
+    e->mime = mime;
+
+    qsort(slowest, numSlowest, sizeof(Entry), compareCost);
+    return 1;
+}
+
+//======================================================================
+
+/*  Fragments that the rules in the magic file look for and that tend
+    to lead into the expensive searches.
+*/
+static const char* const tokens[] = {
+    "#!", "#! ", "/bin/", "<", "<?", "<?xml", "<!DOCTYPE", "<html", "<head",
+    "%!", "%PDF-", "\\", "{", "}", "(", "\n", "\r\n", " ", "\t", "\"",
+    "PK\003\004", "begin ", "From ", "import ", "def ", "#include",
+};
+
+static const size_t numTokens = sizeof(tokens) / sizeof(tokens[0]);
+
+
+
+static size_t
+insert(Byte* buf, size_t len, size_t pos, const Byte* what, size_t n)
+{
+    if (len + n > maxLen)
+    {
+        n = maxLen - len;
+    }
+
+    memmove(buf + pos + n, buf + pos, len - pos);
+    memcpy(buf + pos, what, n);
+    return len + n;
+}
+
+
+
+/*  One random change. Besides the usual ones we repeat a part of the
+    input, since long lines and runs of a character are what make the
+    searches slow.
+*/
+static size_t
+mutate(Byte* buf, size_t len)
+{
+    size_t pos = len ? random() % (len + 1) : 0;
+    size_t n;
+
+    switch (random() % 6)
+    {
+    case 0:
+        if (pos < len)
+        {
+            buf[pos] ^= 1 << (random() % 8);
+        }
+        break;
+
+    case 1:
+        if (pos < len)
+        {
+            buf[pos] = (Byte)random();
+        }
+        break;
+
+    case 2:
+        {
+            const char* t = tokens[random() % numTokens];
+            len = insert(buf, len, pos, (const Byte*)t, strlen(t));
+        }
+        break;
+
+    case 3:
+        if (pos < len)
+        {
+            // Repeat a short run many times.
+            size_t run = 1 + random() % 8;
+            size_t times = 1 + random() % 512;
+
+            if (pos + run > len)
+            {
+                run = len - pos;
+            }
+
+            while (times-- > 0 && len + run <= maxLen)
+            {
+                len = insert(buf, len, pos, buf + pos, run);
+            }
+        }
+        break;
+
+    case 4:
+        len = pos;
+        break;
+
+    case 5:
+        if (popCount > 0)
+        {
+            // Splice in part of another input.
+            const Entry* e = &population[random() % popCount];
+            size_t from = e->len ? random() % e->len : 0;
+
+            n = e->len - from;
+            len = insert(buf, len, pos, e->buf + from, n > 256 ? 256 : n);
+        }
+        break;
+    }
+
+    return len;
+}
+
+//======================================================================
+
+static void
+usage()
+{
+    fprintf(stderr, "Usage: fuzz_slow [-n iterations] [-t secs] [-s seed] [-k keep] [-m maxlen] [-o DIR] [FILE...]\n");
+}
+
+
+
+static void
+addSeed(const Byte* buf, size_t len)
+{
+    const char* mime;
+    int         fresh;
+    uint64_t    cost;
+
+    if (len > maxLen)
+    {
+        len = maxLen;
+    }
+
+    cost = run(buf, len, &fresh, &mime);
+    addToPopulation(buf, len, cost);
+    addToSlowest(buf, len, cost, mime);
+}
+
+
+
+static void
+addFileSeed(const char* path)
+{
+    struct stat st;
+    Byte*   buf;
+    ssize_t n;
+    int     fd;
+
+    fd = open(path, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) < 0)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    buf = (Byte*)malloc(st.st_size + 1);
+    n   = read(fd, buf, st.st_size);
+
+    if (n < 0)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    close(fd);
+    addSeed(buf, n);
+    free(buf);
+}
+
+
+
+static void
+addBuiltinSeeds()
+{
+    // The shapes that we already know to be expensive.
+    Byte*   buf = (Byte*)malloc(maxLen);
+    size_t  len;
+
+    len = insert(buf, 0, 0, (const Byte*)"#!", 2);
+    memset(buf + len, ' ', 4000);
+    addSeed(buf, len + 4000);
+
+    memset(buf, '<', 4096);
+    addSeed(buf, 4096);
+
+    for (len = 0; len + 8 <= 4096; len += 8)
+    {
+        memcpy(buf + len, "a = b;\n ", 8);
+    }
+    addSeed(buf, len);
+
+    free(buf);
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+    const char* outDir = "slow";
+    long        iterations = 100000;
+    time_t      seconds = 0;
+    time_t      deadline;
+    unsigned    seed = 1;
+    size_t      keep = 8;
+    Byte*       buf;
+    long        n;
+    size_t      i;
+    int         ch;
+
+    while ((ch = getopt(argc, argv, "k:m:n:o:s:t:")) != -1)
+    {
+        switch (ch)
+        {
+        case 'k':
+            keep = atoi(optarg);
+            break;
+
+        case 'm':
+            maxLen = atoi(optarg);
+            break;
+
+        case 'n':
+            iterations = atol(optarg);
+            break;
+
+        case 'o':
+            outDir = optarg;
+            break;
+
+        case 's':
+            seed = atoi(optarg);
+            break;
+
+        case 't':
+            seconds = atol(optarg);
+            break;
+
+        default:
+            usage();
+            exit(1);
+        }
+    }
+
+    if (keep == 0 || maxLen == 0)
+    {
+        usage();
+        exit(1);
+    }
+
+    srandom(seed);
+
+    slowest    = (Entry*)calloc(keep, sizeof(Entry));
+    numSlowest = keep;
+    buf        = (Byte*)malloc(maxLen + 1);
+
+    addBuiltinSeeds();
+
+    for (; optind < argc; ++optind)
+    {
+        addFileSeed(argv[optind]);
+    }
+
+    // Some inputs take milliseconds so a time limit is often handier.
+    deadline = seconds ? time(NULL) + seconds : 0;
+
+    for (n = 0; n < iterations && !(deadline && time(NULL) >= deadline); ++n)
+    {
+        // Half the time work on one of the slowest.
+        const Entry* parent;
+        size_t       len;
+        const char*  mime;
+        uint64_t     cost;
+        int          fresh;
+        int          k = 1 + random() % 4;
+
+        if (random() % 2 && slowest[0].buf)
+        {
+            do
+            {
+                parent = &slowest[random() % numSlowest];
+            }
+            while (!parent->buf);
+        }
+        else
+        {
+            parent = &population[random() % popCount];
+        }
+
+        len = parent->len;
+        memcpy(buf, parent->buf, len);
+
+        while (k-- > 0)
+        {
+            len = mutate(buf, len);
+        }
+
+        cost = run(buf, len, &fresh, &mime);
+
+        if (addToSlowest(buf, len, cost, mime) || fresh)
+        {
+            addToPopulation(buf, len, cost);
+        }
+    }
+
+    for (i = 0; i < numSlowest && slowest[i].buf; ++i)
+    {
+        char        path[1024];
+        FILE*       out;
+
+        snprintf(path, sizeof(path), "%s/slow%02zu.bin", outDir, i);
+        out = fopen(path, "wb");
+
+        if (!out)
+        {
+            perror(path);
+            exit(1);
+        }
+
+        fwrite(slowest[i].buf, 1, slowest[i].len, out);
+        fclose(out);
+
+        printf("%s: %llu blocks, %zu bytes, %s\n", path,
+               (unsigned long long)slowest[i].cost, slowest[i].len, slowest[i].mime);
+    }
+
+    return 0;
+}
@@ -0,0 +1,376 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  A client for mimemagicd. It sends the files in batches, first as
+    descriptors and then inline, and checks that each answer is the
+    same as getMimeType() gives here for the same bytes.
+
+    With -p each file is instead sent as a pipe that is never closed,
+    with only its first bytes written. The answer must come after the
+    daemon's read timeout, not wait for EOF, and be the one for those
+    bytes.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include "mimemagic.h"
+#include "mimemagicd.h"
+
+//======================================================================
+
+typedef unsigned char Byte;
+
+enum
+{
+    ReadLen     = 16384,
+    PipeLen     = 512,          // what is written to the pipe
+    PipeMaxSecs = 10,           // far more than the daemon's timeout
+};
+
+
+
+static void
+usage()
+{
+    fprintf(stderr, "Usage: mmd_client [-s socket] [-p] FILE...\n");
+}
+
+
+
+static void
+readFull(int fd, void* buf, size_t len)
+{
+    Byte* bp = (Byte*)buf;
+
+    while (len > 0)
+    {
+        ssize_t n = read(fd, bp, len);
+
+        if (n <= 0)
+        {
+            fprintf(stderr, "mmd_client: no reply from the daemon\n");
+            exit(1);
+        }
+
+        bp  += n;
+        len -= n;
+    }
+}
+
+
+
+/*  Send one batch and check the replies. Returns the number of
+    mismatches.
+*/
+static int
+batch(int sock, char** files, int count, int source)
+{
+    static Byte     data[ReadLen];
+    static Byte     req[MmdMaxFds * (sizeof(MmdItem) + ReadLen) + sizeof(MmdHeader)];
+    MmdHeader       hdr = {MmdMagic, count};
+    size_t          reqLen = sizeof(hdr);
+    int             fds[MmdMaxFds];
+    int             bad = 0;
+    int             i;
+
+    union
+    {
+        struct cmsghdr  align;
+        char            buf[CMSG_SPACE(MmdMaxFds * sizeof(int))];
+    } control;
+
+    struct iovec    iov;
+    struct msghdr   msg;
+
+    memcpy(req, &hdr, sizeof(hdr));
+
+    for (i = 0; i < count; ++i)
+    {
+        MmdItem item = {source, MimeMagicNone, 0, ReadLen};
+
+        fds[i] = open(files[i], O_RDONLY);
+
+        if (fds[i] < 0)
+        {
+            perror(files[i]);
+            exit(1);
+        }
+
+        if (source == MmdInline)
+        {
+            ssize_t n = read(fds[i], data, ReadLen);
+
+            item.len = n > 0 ? n : 0;
+            memcpy(req + reqLen + sizeof(item), data, item.len);
+            close(fds[i]);
+        }
+
+        memcpy(req + reqLen, &item, sizeof(item));
+        reqLen += sizeof(item) + (source == MmdInline ? item.len : 0);
+    }
+
+    iov.iov_base = req;
+    iov.iov_len  = reqLen;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov    = &iov;
+    msg.msg_iovlen = 1;
+
+    if (source == MmdFromFd)
+    {
+        struct cmsghdr* cm;
+
+        msg.msg_control    = control.buf;
+        msg.msg_controllen = CMSG_SPACE(count * sizeof(int));
+
+        cm = CMSG_FIRSTHDR(&msg);
+        cm->cmsg_level = SOL_SOCKET;
+        cm->cmsg_type  = SCM_RIGHTS;
+        cm->cmsg_len   = CMSG_LEN(count * sizeof(int));
+        memcpy(CMSG_DATA(cm), fds, count * sizeof(int));
+    }
+
+    if (sendmsg(sock, &msg, 0) != (ssize_t)reqLen)
+    {
+        perror("sendmsg");
+        exit(1);
+    }
+
+    if (source == MmdFromFd)
+    {
+        for (i = 0; i < count; ++i)
+        {
+            close(fds[i]);
+        }
+    }
+
+    readFull(sock, &hdr, sizeof(hdr));
+
+    if (hdr.magic != MmdMagic || hdr.count != (uint32_t)count)
+    {
+        fprintf(stderr, "mmd_client: a bad reply\n");
+        exit(1);
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        MmdReply    rep;
+        char        name[256];
+        const char* mime = NULL;
+        int         fd = open(files[i], O_RDONLY);
+        ssize_t     n  = read(fd, data, ReadLen);
+        int         r;
+
+        close(fd);
+
+        readFull(sock, &rep, sizeof(rep));
+        readFull(sock, name, rep.nameLen);
+        name[rep.nameLen] = 0;
+
+        r = getMimeType(data, n > 0 ? n : 0, &mime, MimeMagicNone);
+
+        if (rep.result != r || (r > 0 && strcmp(name, mime) != 0))
+        {
+            printf("Failed: %s, %s %d %s, not %d %s\n", files[i],
+                   source == MmdInline ? "inline" : "fd", rep.result, name, r, r > 0 ? mime : "");
+            ++bad;
+        }
+        else
+        {
+            printf("%s\t%s\t%s\n", files[i], source == MmdInline ? "inline" : "fd",
+                   r > 0 ? name : "Unrecognised MIME type");
+        }
+    }
+
+    return bad;
+}
+
+
+
+/*  Send the start of a file down a pipe whose write end stays open.
+    Returns 1 if the answer is wrong.
+*/
+static int
+stalledPipe(int sock, const char* file)
+{
+    static Byte     data[PipeLen];
+    MmdHeader       hdr  = {MmdMagic, 1};
+    MmdItem         item = {MmdFromFd, MimeMagicNone, 0, ReadLen};
+    Byte            req[sizeof(hdr) + sizeof(item)];
+    MmdReply        rep;
+    char            name[256];
+    const char*     mime = NULL;
+    struct timeval  tv = {PipeMaxSecs, 0};
+    int             fd = open(file, O_RDONLY);
+    int             p[2];
+    ssize_t         n;
+    int             r;
+
+    union
+    {
+        struct cmsghdr  align;
+        char            buf[CMSG_SPACE(sizeof(int))];
+    } control;
+
+    struct iovec    iov = {req, sizeof(req)};
+    struct msghdr   msg;
+    struct cmsghdr* cm;
+
+    if (fd < 0 || pipe(p) < 0)
+    {
+        perror(file);
+        exit(1);
+    }
+
+    n = read(fd, data, PipeLen);
+    n = n > 0 ? n : 0;
+    close(fd);
+
+    if (write(p[1], data, n) != n)
+    {
+        perror("write");
+        exit(1);
+    }
+
+    memcpy(req, &hdr, sizeof(hdr));
+    memcpy(req + sizeof(hdr), &item, sizeof(item));
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control.buf;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int));
+
+    cm = CMSG_FIRSTHDR(&msg);
+    cm->cmsg_level = SOL_SOCKET;
+    cm->cmsg_type  = SCM_RIGHTS;
+    cm->cmsg_len   = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cm), &p[0], sizeof(int));
+
+    // Give up rather than wait with the daemon.
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    if (sendmsg(sock, &msg, 0) != (ssize_t)sizeof(req))
+    {
+        perror("sendmsg");
+        exit(1);
+    }
+
+    close(p[0]);
+
+    readFull(sock, &hdr, sizeof(hdr));
+    readFull(sock, &rep, sizeof(rep));
+    readFull(sock, name, rep.nameLen);
+    name[rep.nameLen] = 0;
+    close(p[1]);
+
+    r = getMimeType(data, n, &mime, MimeMagicNone);
+
+    if (rep.result != r || (r > 0 && strcmp(name, mime) != 0))
+    {
+        printf("Failed: %s, pipe %d %s, not %d %s\n", file, rep.result, name, r, r > 0 ? mime : "");
+        return 1;
+    }
+
+    printf("%s\tpipe\t%s\n", file, r > 0 ? name : "Unrecognised MIME type");
+    return 0;
+}
+
+
+
+int
+main(int argc, char** argv)
+{
+    struct sockaddr_un  addr;
+    const char*         path = "/tmp/mimemagicd.sock";
+    int                 sock;
+    int                 bad = 0;
+    int                 stalled = 0;
+    int                 opt;
+    int                 i;
+
+    while ((opt = getopt(argc, argv, "ps:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'p':
+            stalled = 1;
+            break;
+
+        case 's':
+            path = optarg;
+            break;
+
+        default:
+            usage();
+            exit(1);
+        }
+    }
+
+    if (optind == argc || strlen(path) >= sizeof(addr.sun_path))
+    {
+        usage();
+        exit(1);
+    }
+
+    sock = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        perror(path);
+        exit(1);
+    }
+
+    for (i = optind; stalled && i < argc; ++i)
+    {
+        bad += stalledPipe(sock, argv[i]);
+    }
+
+    for (i = optind; !stalled && i < argc; i += MmdMaxFds)
+    {
+        int count = argc - i < MmdMaxFds ? argc - i : MmdMaxFds;
+
+        bad += batch(sock, argv + i, count, MmdFromFd);
+        bad += batch(sock, argv + i, count, MmdInline);
+    }
+
+    close(sock);
+    return bad ? 1 : 0;
+}
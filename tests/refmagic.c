@@ -0,0 +1,423 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  We take the primitives straight from the library source so that they
+    have exactly the same semantics.
+*/
+#include "../prologue.c"
+
+#include "refmagic.h"
+
+//======================================================================
+
+typedef enum NodeKind
+{
+    NodeAlways = 0,         // 'x' and default tests, the offset isn't touched
+    NodeShortGroup,         // one entry of a beShortGroup()
+    NodeStringMapEntry,     // one entry of a stringEqualMap()
+    NodeStringEqual,
+    NodeStringNotEqual,
+    NodeStringLess,
+    NodeStringNotLess,
+    NodeStringGreater,
+    NodeStringNotGreater,
+    NodeStringMatch,
+    NodeSearch,
+    NodeRegex,
+    NodeByte,
+    NodeLeShort,
+    NodeBeShort,
+    NodeLeLong,
+    NodeBeLong,
+    NodeLeQuad,
+    NodeBeQuad,
+    NodeIndirect,           // the whole table again from the offset
+    NodeMpegFrames,
+} NodeKind;
+
+
+/*  The subtests of a node follow it in the table up to the index end.
+*/
+typedef struct Node
+{
+    NodeKind    kind;
+    int         line;           // in the magic file
+    int         level;          // selects the offset variable
+    size_t      end;
+    MimeId      mime;           // set at a leaf
+
+    size_t      offset;
+    Bool        fromEnd;        // offset counts back from the end
+    Bool        inTail;         // the test reads through a View
+    Bool        readsTail;      // the indirect offset does
+    Bool        outerRelative;
+    Bool        indirect;
+    Bool        innerRelative;
+    char        typeFlag;       // for getOffset()
+    char        oper;           // applied to the indirect offset
+    Int         operand;
+
+    const char* target;
+    size_t      tlen;
+    Int         value;
+    int         compare;
+    Mask        mask;
+    size_t      limit;
+    int         flags;
+} Node;
+
+
+#include "refnodes.h"
+
+enum
+{
+    MaxLevels = 16,
+};
+
+static Result walk(const Byte* buf, size_t len, size_t first, size_t last, size_t* off,
+                   Bool* haveError, MimeId* mime);
+
+// The nesting of indirect tests. The interpreter is only used from one thread.
+static int indirectDepth;
+
+// The tail of the file from refMimeTypeHeadTail() or NULL.
+static const Tail* refTail;
+
+//======================================================================
+
+static Result
+refIndirect(const Byte* buf, size_t len, size_t offset, MimeId* mime)
+{
+    // As in indirectMatch() in the generated code.
+    size_t  off[MaxLevels] = {0};
+    Bool    haveError = False;
+    const Tail* tail = refTail;
+    Tail    inner;
+    Result  r;
+
+    if (offset >= len)
+    {
+        return Error;
+    }
+
+    if (indirectDepth >= MaxIndirect)
+    {
+        return Fail;
+    }
+
+    if (tail)
+    {
+        size_t start = tail->size - tail->len;
+        size_t cut   = offset > start? offset - start : 0;
+
+        inner.buf  = tail->buf + cut;
+        inner.len  = tail->len - cut;
+        inner.size = tail->size - offset;
+        refTail = &inner;
+    }
+
+    ++indirectDepth;
+    r = walk(buf + offset, len - offset, 0, refNodeCount, off, &haveError, mime);
+    --indirectDepth;
+    refTail = tail;
+
+    return r == Fail && haveError? Error : r;
+}
+
+
+
+static Result
+nodeOffset(const Node* n, const Byte* buf, size_t len, size_t* off)
+{
+    // As in Generate.genOffset()
+    size_t* ovar = &off[n->level];
+    Result  rslt = Match;
+    SegmentState state = {0, 0, 0, indirectDepth, refTail, NULL};
+
+    *ovar = n->offset;
+
+    if (n->fromEnd)
+    {
+        rslt = endOffset(len, &state, n->offset, ovar);
+
+        if (rslt <= 0)
+        {
+            return rslt;
+        }
+    }
+
+    if (n->indirect)
+    {
+        if (n->innerRelative)
+        {
+            *ovar += off[n->level - 1];
+        }
+
+        if (n->readsTail)
+        {
+            View view = fileView(buf, len, &state, *ovar);
+
+            rslt = getOffset(view.buf, view.len, *ovar - view.base, n->typeFlag, ovar);
+        }
+        else
+        {
+            rslt = getOffset(buf, len, *ovar, n->typeFlag, ovar);
+        }
+
+        if (rslt > 0 && n->oper)
+        {
+            rslt = offsetArith(ovar, n->oper, n->operand);
+        }
+    }
+
+    if (n->outerRelative)
+    {
+        *ovar += off[n->level - 1];
+    }
+
+    return rslt;
+}
+
+
+
+static Result
+nodeMatch(const Node* n, const Byte* buf, size_t len, size_t* ovar, MimeId* mime)
+{
+    switch (n->kind)
+    {
+    case NodeStringEqual:       return stringEqual(buf, len, n->target, n->tlen, ovar);
+    case NodeStringNotEqual:    return !stringEqual(buf, len, n->target, n->tlen, ovar);
+    case NodeStringLess:        return stringLess(buf, len, n->target, n->tlen, ovar);
+    case NodeStringNotLess:     return !stringLess(buf, len, n->target, n->tlen, ovar);
+    case NodeStringGreater:     return stringGreater(buf, len, n->target, n->tlen, ovar);
+    case NodeStringNotGreater:  return !stringGreater(buf, len, n->target, n->tlen, ovar);
+
+    case NodeStringMatch:
+        return stringMatch(buf, len, n->target, n->tlen, ovar, n->compare, n->flags);
+
+    case NodeSearch:
+        return stringSearch(buf, len, n->target, n->tlen, ovar, n->limit, n->flags);
+
+    case NodeRegex:
+        return regexMatch(buf, len, n->target, ovar, n->limit, n->flags);
+
+    case NodeByte:      return byteMatch(buf, len, n->value, n->compare, n->mask, ovar);
+    case NodeLeShort:   return leShortMatch(buf, len, n->value, n->compare, n->mask, ovar);
+    case NodeBeShort:   return beShortMatch(buf, len, n->value, n->compare, n->mask, ovar);
+    case NodeLeLong:    return leLongMatch(buf, len, n->value, n->compare, n->mask, ovar);
+    case NodeBeLong:    return beLongMatch(buf, len, n->value, n->compare, n->mask, ovar);
+    case NodeLeQuad:    return leQuadMatch(buf, len, n->value, n->compare, n->mask, ovar);
+    case NodeBeQuad:    return beQuadMatch(buf, len, n->value, n->compare, n->mask, ovar);
+
+    case NodeIndirect:  return refIndirect(buf, len, *ovar, mime);
+    case NodeMpegFrames: return mpegFrames(buf, len, ovar);
+
+    default:
+        break;
+    }
+
+    return Fail;
+}
+
+
+
+static Result
+nodeTest(const Node* n, const Byte* buf, size_t len, size_t* off, MimeId* mime)
+{
+    // The reference doesn't record where the match was.
+    SegmentState    state = {0, 0, 0, indirectDepth, refTail, NULL};
+    size_t*         ovar  = &off[n->level];
+    Result          rslt;
+
+    switch (n->kind)
+    {
+    case NodeAlways:
+        return Match;
+
+    case NodeShortGroup:
+        {
+            ShortMap entry = {n->value, n->mask, n->mime, 0};
+            return beShortGroup(buf, len, &entry, 1, mime, &state);
+        }
+
+    case NodeStringMapEntry:
+        {
+            StringMap entry = {n->target, n->tlen, n->mime, 0};
+            return stringEqualMap(buf, len, &entry, 1, mime, &state);
+        }
+
+    default:
+        break;
+    }
+
+    rslt = nodeOffset(n, buf, len, off);
+
+    if (rslt <= 0)
+    {
+        return rslt;
+    }
+
+    if (n->inTail)
+    {
+        View view = fileView(buf, len, &state, *ovar);
+
+        *ovar -= view.base;
+        rslt   = nodeMatch(n, view.buf, view.len, ovar, mime);
+        *ovar += view.base;
+        return rslt;
+    }
+
+    return nodeMatch(n, buf, len, ovar, mime);
+}
+
+
+
+static Result
+walk(const Byte* buf, size_t len, size_t first, size_t last, size_t* off, Bool* haveError, MimeId* mime)
+{
+    // Test the siblings in turn, descending into each one that passes.
+    size_t i = first;
+
+    while (i < last)
+    {
+        const Node* n    = &refNodes[i];
+        Result      rslt = nodeTest(n, buf, len, off, mime);
+
+        if (rslt < 0)
+        {
+            *haveError = True;
+        }
+
+        if (rslt > 0)
+        {
+            // An indirect match has already set the MIME.
+            if (n->kind == NodeIndirect)
+            {
+                return Match;
+            }
+
+            if (n->mime != NoMime)
+            {
+                *mime = n->mime;
+                return Match;
+            }
+
+            if (walk(buf, len, i + 1, n->end, off, haveError, mime) > 0)
+            {
+                return Match;
+            }
+        }
+
+        i = n->end;
+    }
+
+    return Fail;
+}
+
+
+
+int
+refMimeType(const Byte* buf, size_t len, const char** mime, int flags)
+{
+    size_t  off[MaxLevels] = {0};
+    Bool    haveError = False;
+    MimeId  id = NoMime;
+    Result  r;
+
+    *mime = NULL;
+
+    if (len == 0)
+    {
+        return Error;
+    }
+
+    r = walk(buf, len, 0, refNodeCount, off, &haveError, &id);
+
+    if (r == Fail && haveError)
+    {
+        r = Error;
+    }
+
+    // As in findMimeId().
+    if (r <= 0 && !(flags & MimeMagicNoTryText))
+    {
+        int t = tryPlainText(buf, len, mime, flags);
+
+        return t > 0? t : (r < 0 || t < 0)? Error : Fail;
+    }
+
+    if (r > 0)
+    {
+        *mime = mimeNames[id];
+    }
+
+    return r;
+}
+
+
+
+int
+refMimeTypeHeadTail(
+    const Byte* head,
+    size_t      headLen,
+    const Byte* tail,
+    size_t      tailLen,
+    size_t      size,
+    const char** mime,
+    int         flags
+    )
+{
+    // As in getMimeTypeHeadTail().
+    Tail    t;
+    int     r;
+
+    if (headLen > size)
+    {
+        headLen = size;
+    }
+
+    if (tailLen > size)
+    {
+        tail   += tailLen - size;
+        tailLen = size;
+    }
+
+    if (headLen == size)
+    {
+        tail    = head;
+        tailLen = headLen;
+    }
+
+    t.buf  = tail;
+    t.len  = tailLen;
+    t.size = size;
+
+    refTail = &t;
+    r = refMimeType(head, headLen, mime, flags);
+    refTail = NULL;
+
+    return r;
+}
@@ -0,0 +1,871 @@
+/*  This file is generated by compile.py for refmagic.c. Don't edit it.
+*/
+
+#define MimeCount 200
+
+static const char* const mimeNames[MimeCount] = {
+    NULL,
+    "text/plain; charset=US-ASCII",    // 1
+    "text/plain; charset=UTF-8",    // 2
+    "text/plain; charset=UTF-16",    // 3
+    "application/dicom",    // 4
+    "application/epub+zip",    // 5
+    "application/java-archive",    // 6
+    "application/javascript",    // 7
+    "application/msword",    // 8
+    "application/octet-stream",    // 9
+    "application/ogg",    // 10
+    "application/pdf",    // 11
+    "application/pgp",    // 12
+    "application/pgp-keys",    // 13
+    "application/pgp-signature",    // 14
+    "application/postscript",    // 15
+    "application/unknown+zip",    // 16
+    "application/vnd.cups-raster",    // 17
+    "application/vnd.debian.binary-package",    // 18
+    "application/vnd.fdf",    // 19
+    "application/vnd.google-earth.kml+xml",    // 20
+    "application/vnd.google-earth.kmz",    // 21
+    "application/vnd.ms-cab-compressed",    // 22
+    "application/vnd.ms-excel",    // 23
+    "application/vnd.ms-fontobject",    // 24
+    "application/vnd.ms-opentype",    // 25
+    "application/vnd.oasis.opendocument.chart",    // 26
+    "application/vnd.oasis.opendocument.chart-template",    // 27
+    "application/vnd.oasis.opendocument.database",    // 28
+    "application/vnd.oasis.opendocument.formula",    // 29
+    "application/vnd.oasis.opendocument.formula-template",    // 30
+    "application/vnd.oasis.opendocument.graphics",    // 31
+    "application/vnd.oasis.opendocument.graphics-template",    // 32
+    "application/vnd.oasis.opendocument.image",    // 33
+    "application/vnd.oasis.opendocument.image-template",    // 34
+    "application/vnd.oasis.opendocument.presentation",    // 35
+    "application/vnd.oasis.opendocument.presentation-template",    // 36
+    "application/vnd.oasis.opendocument.spreadsheet",    // 37
+    "application/vnd.oasis.opendocument.spreadsheet-template",    // 38
+    "application/vnd.oasis.opendocument.text",    // 39
+    "application/vnd.oasis.opendocument.text-master",    // 40
+    "application/vnd.oasis.opendocument.text-template",    // 41
+    "application/vnd.oasis.opendocument.text-web",    // 42
+    "application/vnd.openxmlformats-officedocument.presentationml.presentation",    // 43
+    "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",    // 44
+    "application/vnd.openxmlformats-officedocument.wordprocessingml.document",    // 45
+    "application/vnd.rn-realmedia",    // 46
+    "application/x-7z-compressed",    // 47
+    "application/x-abook-addressbook",    // 48
+    "application/x-bittorrent",    // 49
+    "application/x-bzip2",    // 50
+    "application/x-coredump",    // 51
+    "application/x-dbf",    // 52
+    "application/x-dvi",    // 53
+    "application/x-eet",    // 54
+    "application/x-epoc-agenda",    // 55
+    "application/x-epoc-app",    // 56
+    "application/x-epoc-data",    // 57
+    "application/x-epoc-jotter",    // 58
+    "application/x-epoc-opl",    // 59
+    "application/x-epoc-opo",    // 60
+    "application/x-epoc-sheet",    // 61
+    "application/x-epoc-word",    // 62
+    "application/x-executable",    // 63
+    "application/x-font-sfn",    // 64
+    "application/x-font-ttf",    // 65
+    "application/x-freemind",    // 66
+    "application/x-freeplane",    // 67
+    "application/x-gdbm",    // 68
+    "application/x-gnucash",    // 69
+    "application/x-gnupg-keyring",    // 70
+    "application/x-hdf",    // 71
+    "application/x-hwp",    // 72
+    "application/x-ia-arc",    // 73
+    "application/x-ichitaro4",    // 74
+    "application/x-ichitaro5",    // 75
+    "application/x-ichitaro6",    // 76
+    "application/x-ima",    // 77
+    "application/x-iso9660-image",    // 78
+    "application/x-java-applet",    // 79
+    "application/x-java-pack200",    // 80
+    "application/x-kdelnk",    // 81
+    "application/x-lrzip",    // 82
+    "application/x-lz4",    // 83
+    "application/x-lzma",    // 84
+    "application/x-mif",    // 85
+    "application/x-ms-reader",    // 86
+    "application/x-msaccess",    // 87
+    "application/x-object",    // 88
+    "application/x-pgp-keyring",    // 89
+    "application/x-pnf",    // 90
+    "application/x-quicktime-player",    // 91
+    "application/x-rar",    // 92
+    "application/x-rpm",    // 93
+    "application/x-scribus",    // 94
+    "application/x-setupscript",    // 95
+    "application/x-sharedlib",    // 96
+    "application/x-shockwave-flash",    // 97
+    "application/x-svr4-package",    // 98
+    "application/x-tar",    // 99
+    "application/x-tex-tfm",    // 100
+    "application/x-wine-extension-ini",    // 101
+    "application/x-xz",    // 102
+    "application/xml",    // 103
+    "application/xml-sitemap",    // 104
+    "application/zip",    // 105
+    "audio/basic",    // 106
+    "audio/midi",    // 107
+    "audio/mp4",    // 108
+    "audio/mpeg",    // 109
+    "audio/vnd.dolby.dd-raw",    // 110
+    "audio/x-adpcm",    // 111
+    "audio/x-ape",    // 112
+    "audio/x-flac",    // 113
+    "audio/x-hx-aac-adif",    // 114
+    "audio/x-hx-aac-adts",    // 115
+    "audio/x-mp4a-latm",    // 116
+    "audio/x-musepack",    // 117
+    "audio/x-pn-realaudio",    // 118
+    "audio/x-wav",    // 119
+    "chemical/x-pdb",    // 120
+    "image/gif",    // 121
+    "image/jp2",    // 122
+    "image/jpeg",    // 123
+    "image/jpm",    // 124
+    "image/jpx",    // 125
+    "image/png",    // 126
+    "image/svg+xml",    // 127
+    "image/tiff",    // 128
+    "image/vnd.adobe.photoshop",    // 129
+    "image/vnd.djvu",    // 130
+    "image/vnd.dwg",    // 131
+    "image/webp",    // 132
+    "image/x-award-bmp",    // 133
+    "image/x-canon-cr2",    // 134
+    "image/x-canon-crw",    // 135
+    "image/x-coreldraw",    // 136
+    "image/x-cur",    // 137
+    "image/x-epoc-sketch",    // 138
+    "image/x-exr",    // 139
+    "image/x-icon",    // 140
+    "image/x-ms-bmp",    // 141
+    "image/x-olympus-orf",    // 142
+    "image/x-paintnet",    // 143
+    "image/x-pcx",    // 144
+    "image/x-polar-monitor-bitmap",    // 145
+    "image/x-portable-bitmap",    // 146
+    "image/x-portable-greymap",    // 147
+    "image/x-portable-pixmap",    // 148
+    "image/x-quicktime",    // 149
+    "image/x-xcf",    // 150
+    "image/x-xcursor",    // 151
+    "image/x-xpmi",    // 152
+    "image/x-xwindowdump",    // 153
+    "model/vrml",    // 154
+    "model/x3d",    // 155
+    "rinex/broadcast",    // 156
+    "rinex/clock",    // 157
+    "rinex/meteorological",    // 158
+    "rinex/navigation",    // 159
+    "rinex/observation",    // 160
+    "text/PGP",    // 161
+    "text/calendar",    // 162
+    "text/html",    // 163
+    "text/inf",    // 164
+    "text/rtf",    // 165
+    "text/texmacs",    // 166
+    "text/x-awk",    // 167
+    "text/x-gawk",    // 168
+    "text/x-info",    // 169
+    "text/x-lua",    // 170
+    "text/x-msdos-batch",    // 171
+    "text/x-nawk",    // 172
+    "text/x-perl",    // 173
+    "text/x-php",    // 174
+    "text/x-python",    // 175
+    "text/x-ruby",    // 176
+    "text/x-shellscript",    // 177
+    "text/x-tcl",    // 178
+    "text/x-tex",    // 179
+    "text/x-texinfo",    // 180
+    "text/x-vcard",    // 181
+    "text/x-xmcd",    // 182
+    "video/3gpp",    // 183
+    "video/3gpp2",    // 184
+    "video/mj2",    // 185
+    "video/mp4",    // 186
+    "video/mpeg",    // 187
+    "video/mpeg4-generic",    // 188
+    "video/quicktime",    // 189
+    "video/webm",    // 190
+    "video/x-flc",    // 191
+    "video/x-fli",    // 192
+    "video/x-flv",    // 193
+    "video/x-matroska",    // 194
+    "video/x-mng",    // 195
+    "video/x-ms-asf",    // 196
+    "video/x-msvideo",    // 197
+    "x-epoc/x-sisx-app",    // 198
+    "image/bmp",    // 199
+};
+
+static const Node refNodes[] = {
+    {.kind = NodeShortGroup, .line = 810, .level = 0, .end = 1, .mime = 109, .value = 0xFFFC, .mask = 0xFFFE},
+    {.kind = NodeShortGroup, .line = 885, .level = 0, .end = 2, .mime = 109, .value = 0xFFF2, .mask = 0xFFFE},
+    {.kind = NodeShortGroup, .line = 920, .level = 0, .end = 3, .mime = 109, .value = 0xFFF4, .mask = 0xFFFE},
+    {.kind = NodeShortGroup, .line = 955, .level = 0, .end = 4, .mime = 109, .value = 0xFFF6, .mask = 0xFFFE},
+    {.kind = NodeShortGroup, .line = 990, .level = 0, .end = 5, .mime = 109, .value = 0xFFE2, .mask = 0xFFFE},
+    {.kind = NodeShortGroup, .line = 1052, .level = 0, .end = 6, .mime = 115, .value = 0xFFF0, .mask = 0xFFF6},
+    {.kind = NodeShortGroup, .line = 1089, .level = 0, .end = 7, .mime = 116, .value = 0x56E0, .mask = 0xFFE0},
+    {.kind = NodeShortGroup, .line = 5356, .level = 0, .end = 8, .mime = 110, .value = 0x0b77, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 7048, .level = 0, .end = 9, .mime = 161, .value = 0x8502, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 7053, .level = 0, .end = 10, .mime = 70, .value = 0x9901, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 9237, .level = 0, .end = 11, .mime = 123, .value = 0xffd8, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 15630, .level = 0, .end = 12, .mime = 89, .value = 0x9900, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 15632, .level = 0, .end = 13, .mime = 89, .value = 0x9501, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 15634, .level = 0, .end = 14, .mime = 89, .value = 0x9500, .mask = 0xffff},
+    {.kind = NodeShortGroup, .line = 15636, .level = 0, .end = 15, .mime = 161, .value = 0xa600, .mask = 0xffff},
+    {.kind = NodeBeLong, .line = 548, .level = 0, .end = 20, .offset = 0, .value = 0x00000100, .compare = CompareEq, .mask = 0xFFFFFF00},
+    {.kind = NodeByte, .line = 549, .level = 1, .end = 17, .mime = 187, .offset = 3, .value = 0xBA, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 560, .level = 1, .end = 18, .mime = 188, .offset = 3, .value = 0xB0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 632, .level = 1, .end = 19, .mime = 188, .offset = 3, .value = 0xB5, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 643, .level = 1, .end = 20, .mime = 187, .offset = 3, .value = 0xB3, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeShort, .line = 762, .level = 0, .end = 35, .offset = 0, .value = 0xFFFA, .compare = CompareEq, .mask = 0xFFFE},
+    {.kind = NodeByte, .line = 764, .level = 1, .end = 22, .mime = 109, .offset = 2, .value = 0x10, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 766, .level = 1, .end = 23, .mime = 109, .offset = 2, .value = 0x20, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 768, .level = 1, .end = 24, .mime = 109, .offset = 2, .value = 0x30, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 770, .level = 1, .end = 25, .mime = 109, .offset = 2, .value = 0x40, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 772, .level = 1, .end = 26, .mime = 109, .offset = 2, .value = 0x50, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 774, .level = 1, .end = 27, .mime = 109, .offset = 2, .value = 0x60, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 776, .level = 1, .end = 28, .mime = 109, .offset = 2, .value = 0x70, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 778, .level = 1, .end = 29, .mime = 109, .offset = 2, .value = 0x80, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 780, .level = 1, .end = 30, .mime = 109, .offset = 2, .value = 0x90, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 782, .level = 1, .end = 31, .mime = 109, .offset = 2, .value = 0xA0, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 784, .level = 1, .end = 32, .mime = 109, .offset = 2, .value = 0xB0, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 786, .level = 1, .end = 33, .mime = 109, .offset = 2, .value = 0xC0, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 788, .level = 1, .end = 34, .mime = 109, .offset = 2, .value = 0xD0, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeByte, .line = 790, .level = 1, .end = 35, .mime = 109, .offset = 2, .value = 0xE0, .compare = CompareEq, .mask = 0xF0},
+    {.kind = NodeLeShort, .line = 1111, .level = 0, .end = 39, .offset = 4, .value = 0xAF11, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 1113, .level = 1, .end = 39, .offset = 8, .value = 320, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 1114, .level = 2, .end = 39, .offset = 10, .value = 200, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 1115, .level = 3, .end = 39, .mime = 192, .offset = 12, .value = 8, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 1124, .level = 0, .end = 41, .offset = 4, .value = 0xAF12, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 1126, .level = 1, .end = 41, .mime = 191, .offset = 12, .value = 8, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 1181, .level = 0, .end = 42, .mime = 196, .offset = 0, .value = 0x3026b275, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2289, .level = 0, .end = 43, .mime = 54, .offset = 0, .value = 0x1ee7ff00, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 2314, .level = 0, .end = 44, .mime = 198, .offset = 0, .value = 0x10201A7A, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2374, .level = 0, .end = 47, .offset = 0, .value = 0xFEEF0100, .compare = CompareEq, .mask = 0xFFFFf7f0},
+    {.kind = NodeSearch, .line = 2400, .level = 1, .end = 47, .offset = 0xE08, .target = "U" "\xaa", .tlen = sizeof("U" "\xaa") - 1, .limit = 7776, .flags = 0},
+    {.kind = NodeIndirect, .line = 2401, .level = 2, .end = 47, .offset = -512, .outerRelative = True},
+    {.kind = NodeBeLong, .line = 2406, .level = 0, .end = 50, .offset = 0, .value = 0xFEEF0100, .compare = CompareEq, .mask = 0xFFFFf7f0},
+    {.kind = NodeSearch, .line = 2432, .level = 1, .end = 50, .offset = 0xE08, .target = "U" "\xaa", .tlen = sizeof("U" "\xaa") - 1, .limit = 7776, .flags = 0},
+    {.kind = NodeIndirect, .line = 2433, .level = 2, .end = 50, .offset = -512, .outerRelative = True},
+    {.kind = NodeBeLong, .line = 2629, .level = 0, .end = 51, .mime = 118, .offset = 0, .value = 0x2e7261fd, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 3676, .level = 0, .end = 53, .offset = 0, .value = 0xcafebabe, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 3677, .level = 1, .end = 53, .mime = 79, .offset = 4, .value = 30, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 3690, .level = 0, .end = 55, .offset = 0, .value = 0xcafed00d, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 3692, .level = 1, .end = 55, .mime = 80},
+    {.kind = NodeBeLong, .line = 3696, .level = 0, .end = 58, .offset = 0, .value = 0xcafed00d, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 3698, .level = 1, .end = 57, .mime = 80},
+    {.kind = NodeIndirect, .line = 3706, .level = 1, .end = 58, .offset = 8, .outerRelative = True, .indirect = True, .typeFlag = 'L'},
+    {.kind = NodeLeShort, .line = 4099, .level = 0, .end = 59, .mime = 9, .offset = 0, .value = 0x1f1f, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 4105, .level = 0, .end = 60, .mime = 9, .offset = 0, .value = 0x1fff, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 4111, .level = 0, .end = 61, .mime = 9, .offset = 0, .value = 0145405, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 4232, .level = 0, .end = 63, .offset = 0, .value = 0x5d, .compare = CompareEq, .mask = 0xffffff},
+    {.kind = NodeLeShort, .line = 4233, .level = 1, .end = 63, .mime = 84, .offset = 12, .value = 0xff, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 4252, .level = 0, .end = 64, .mime = 83, .offset = 0, .value = 0x184d2204, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 4255, .level = 0, .end = 65, .mime = 83, .offset = 0, .value = 0x184c2103, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 4257, .level = 0, .end = 66, .mime = 83, .offset = 0, .value = 0x184c2102, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 4755, .level = 0, .end = 67, .mime = 68, .offset = 0, .value = 0x13579acd, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 4757, .level = 0, .end = 68, .mime = 68, .offset = 0, .value = 0x13579acd, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 4759, .level = 0, .end = 69, .mime = 68, .offset = 0, .value = 0x13579acf, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 4761, .level = 0, .end = 70, .mime = 68, .offset = 0, .value = 0x13579acf, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 4893, .level = 0, .end = 88, .offset = 0, .value = 0x00000C20, .compare = CompareLt, .mask = 0x0000FFFF},
+    {.kind = NodeByte, .line = 4982, .level = 1, .end = 88, .offset = 0, .value = 1, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 4985, .level = 2, .end = 73, .mime = 52, .offset = 0, .value = 0x03, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 4988, .level = 2, .end = 74, .mime = 52, .offset = 0, .value = 0x04, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 4991, .level = 2, .end = 75, .mime = 52, .offset = 0, .value = 0x05, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 4993, .level = 2, .end = 76, .mime = 52, .offset = 0, .value = 0x30, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 4995, .level = 2, .end = 77, .mime = 52, .offset = 0, .value = 0x31, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 4998, .level = 2, .end = 78, .mime = 52, .offset = 0, .value = 0x32, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5001, .level = 2, .end = 79, .mime = 52, .offset = 0, .value = 0x43, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5007, .level = 2, .end = 80, .mime = 52, .offset = 0, .value = 0x7b, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5013, .level = 2, .end = 81, .mime = 52, .offset = 0, .value = 0x83, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5016, .level = 2, .end = 82, .mime = 52, .offset = 0, .value = 0x87, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5022, .level = 2, .end = 83, .mime = 52, .offset = 0, .value = 0x8B, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5025, .level = 2, .end = 84, .mime = 52, .offset = 0, .value = 0x8E, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5033, .level = 2, .end = 85, .mime = 52, .offset = 0, .value = 0xCB, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5036, .level = 2, .end = 86, .mime = 52, .offset = 0, .value = 0xE5, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 5041, .level = 2, .end = 87, .mime = 52, .offset = 0, .value = 0xF5, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 5047, .level = 2, .end = 88, .mime = 52},
+    {.kind = NodeLeLong, .line = 5598, .level = 0, .end = 94, .offset = 0, .value = 0x0ef1fab9, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 5626, .level = 1, .end = 90, .mime = 9, .offset = 16, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 5628, .level = 1, .end = 91, .mime = 88, .offset = 16, .value = 1, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 5630, .level = 1, .end = 92, .mime = 63, .offset = 16, .value = 2, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 5632, .level = 1, .end = 93, .mime = 96, .offset = 16, .value = 3, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 5634, .level = 1, .end = 94, .mime = 51, .offset = 16, .value = 4, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5961, .level = 0, .end = 102, .offset = 0, .value = 0x10000037, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5968, .level = 1, .end = 100, .offset = 4, .value = 0x1000006D, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5969, .level = 2, .end = 97, .mime = 138, .offset = 8, .value = 0x1000007D, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5972, .level = 2, .end = 98, .mime = 62, .offset = 8, .value = 0x1000007F, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5974, .level = 2, .end = 99, .mime = 59, .offset = 8, .value = 0x10000085, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5977, .level = 2, .end = 100, .mime = 61, .offset = 8, .value = 0x10000088, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5980, .level = 1, .end = 101, .mime = 60, .offset = 4, .value = 0x10000073, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5982, .level = 1, .end = 102, .mime = 56, .offset = 4, .value = 0x10000074, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5990, .level = 0, .end = 107, .offset = 0, .value = 0x10000050, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5991, .level = 1, .end = 107, .offset = 4, .value = 0x1000006D, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5992, .level = 2, .end = 105, .mime = 55, .offset = 8, .value = 0x10000084, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5994, .level = 2, .end = 106, .mime = 57, .offset = 8, .value = 0x10000086, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 5996, .level = 2, .end = 107, .mime = 58, .offset = 8, .value = 0x10000CEA, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 6133, .level = 0, .end = 108, .mime = 64, .offset = 0, .value = 00000004, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 6137, .level = 0, .end = 110, .offset = 0, .value = 00000004, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 6138, .level = 1, .end = 110, .mime = 64, .offset = 104, .value = 00000004, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 8537, .level = 0, .end = 114, .offset = 0, .value = 100, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 8538, .level = 1, .end = 114, .offset = 8, .value = 3, .compare = CompareLt, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 8539, .level = 2, .end = 114, .offset = 12, .value = 33, .compare = CompareLt, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 8540, .level = 3, .end = 114, .mime = 153, .offset = 4, .value = 7, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 8605, .level = 0, .end = 118, .offset = 0, .value = 0x0a000000, .compare = CompareEq, .mask = 0xffF8fe00},
+    {.kind = NodeByte, .line = 8607, .level = 1, .end = 118, .offset = 3, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 8609, .level = 2, .end = 118, .offset = 1, .value = 6, .compare = CompareLt, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 8610, .level = 3, .end = 118, .mime = 144, .offset = 1, .value = 1, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 8819, .level = 0, .end = 119, .mime = 139, .offset = 0, .value = 20000630, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 8879, .level = 0, .end = 120, .mime = 71, .offset = 0, .value = 0x0e031301, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 11174, .level = 0, .end = 134, .offset = 0, .value = 0x000000E9, .compare = CompareEq, .mask = 0x804000E9},
+    {.kind = NodeLeShort, .line = 11178, .level = 1, .end = 134, .offset = 11, .value = 0, .compare = CompareEq, .mask = 0xf001f},
+    {.kind = NodeLeShort, .line = 11179, .level = 2, .end = 134, .offset = 11, .value = 32769, .compare = CompareLt, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 11180, .level = 3, .end = 134, .offset = 11, .value = 31, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 11181, .level = 4, .end = 134, .offset = 21, .value = 0xF0, .compare = CompareEq, .mask = 0xf0},
+    {.kind = NodeByte, .line = 11286, .level = 5, .end = 128, .offset = 21, .value = 0xF8, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringNotEqual, .line = 11288, .level = 6, .end = 128, .offset = 54, .target = "FAT16", .tlen = sizeof("FAT16") - 1},
+    {.kind = NodeLeLong, .line = 11290, .level = 7, .end = 128, .mime = 77, .offset = 11, .indirect = True, .typeFlag = 's', .value = 0x00ffffF0, .compare = CompareEq, .mask = 0x00ffffF0},
+    {.kind = NodeByte, .line = 11296, .level = 5, .end = 134, .offset = 16, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 11298, .level = 6, .end = 134, .offset = 17, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 11300, .level = 7, .end = 134, .offset = 19, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 11304, .level = 8, .end = 134, .offset = 22, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeLong, .line = 11324, .level = 9, .end = 134, .offset = 0x258, .value = 0x00009090, .compare = CompareEq, .mask = 0x00009090},
+    {.kind = NodeIndirect, .line = 11325, .level = 10, .end = 134, .offset = -92, .outerRelative = True},
+    {.kind = NodeBeLong, .line = 12823, .level = 0, .end = 138, .offset = 0, .value = 0x1a45dfa3, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeSearch, .line = 12825, .level = 1, .end = 138, .offset = 4, .target = "B" "\x82", .tlen = sizeof("B" "\x82") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeStringMatch, .line = 12827, .level = 2, .end = 137, .mime = 190, .offset = 1, .outerRelative = True, .target = "webm", .tlen = sizeof("webm") - 1, .compare = CompareEq, .flags = 0},
+    {.kind = NodeStringMatch, .line = 12829, .level = 2, .end = 138, .mime = 194, .offset = 1, .outerRelative = True, .target = "matroska", .tlen = sizeof("matroska") - 1, .compare = CompareEq, .flags = 0},
+    {.kind = NodeBeLong, .line = 13660, .level = 0, .end = 139, .mime = 8, .offset = 0, .value = 0x31be0000, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 13760, .level = 0, .end = 144, .offset = 0, .value = 0x00000100, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 13761, .level = 1, .end = 142, .offset = 9, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 13762, .level = 2, .end = 142, .mime = 140},
+    {.kind = NodeByte, .line = 13765, .level = 1, .end = 144, .offset = 9, .value = 0xff, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 13766, .level = 2, .end = 144, .mime = 140},
+    {.kind = NodeBeLong, .line = 13782, .level = 0, .end = 149, .offset = 0, .value = 0x00000200, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 13783, .level = 1, .end = 147, .offset = 9, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 13784, .level = 2, .end = 147, .mime = 137},
+    {.kind = NodeByte, .line = 13787, .level = 1, .end = 149, .offset = 9, .value = 0xff, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeAlways, .line = 13788, .level = 2, .end = 149, .mime = 137},
+    {.kind = NodeBeShort, .line = 16565, .level = 0, .end = 159, .offset = 0, .value = 0x4552, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 16566, .level = 1, .end = 159, .offset = 4, .value = 0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeIndirect, .line = 16574, .level = 2, .end = 152, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 1},
+    {.kind = NodeIndirect, .line = 16575, .level = 2, .end = 153, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 2},
+    {.kind = NodeIndirect, .line = 16576, .level = 2, .end = 154, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 3},
+    {.kind = NodeIndirect, .line = 16577, .level = 2, .end = 155, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 4},
+    {.kind = NodeIndirect, .line = 16578, .level = 2, .end = 156, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 5},
+    {.kind = NodeIndirect, .line = 16579, .level = 2, .end = 157, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 6},
+    {.kind = NodeIndirect, .line = 16580, .level = 2, .end = 158, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 7},
+    {.kind = NodeIndirect, .line = 16581, .level = 2, .end = 159, .offset = 2, .indirect = True, .typeFlag = 'S', .oper = '*', .operand = 8},
+    {.kind = NodeBeLong, .line = 17052, .level = 0, .end = 160, .mime = 93, .offset = 0, .value = 0xedabeedb, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 20142, .level = 0, .end = 164, .offset = 0, .value = 0x0000, .compare = CompareEq, .mask = 0xFeFe},
+    {.kind = NodeLeLong, .line = 20144, .level = 1, .end = 164, .offset = 4, .value = 0x00000000, .compare = CompareEq, .mask = 0xFCffFe00},
+    {.kind = NodeLeLong, .line = 20146, .level = 2, .end = 164, .offset = 68, .value = 0x57, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 20149, .level = 3, .end = 164, .mime = 90, .offset = 68, .indirect = True, .typeFlag = 'l', .oper = '-', .operand = 1, .value = 0x00400018, .compare = CompareEq, .mask = 0xffE0C519},
+    {.kind = NodeStringMapEntry, .line = 6177, .level = 0, .end = 165, .mime = 65, .target = "\x00" "\x01" "\x00" "\x00" "\x00", .tlen = sizeof("\x00" "\x01" "\x00" "\x00" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 15712, .level = 0, .end = 166, .mime = 15, .target = "\x04" "%!", .tlen = sizeof("\x04" "%!") - 1},
+    {.kind = NodeStringMapEntry, .line = 13692, .level = 0, .end = 167, .mime = 23, .target = "\t" "\x04" "\x06" "\x00" "\x00" "\x00" "\x10" "\x00", .tlen = sizeof("\t" "\x04" "\x06" "\x00" "\x00" "\x00" "\x10" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 4093, .level = 0, .end = 168, .mime = 9, .target = "\x1f" "\x1e", .tlen = sizeof("\x1f" "\x1e") - 1},
+    {.kind = NodeStringMapEntry, .line = 12115, .level = 0, .end = 169, .mime = 81, .target = "# KDE Config File", .tlen = sizeof("# KDE Config File") - 1},
+    {.kind = NodeStringMapEntry, .line = 15656, .level = 0, .end = 170, .mime = 98, .target = "# PaCkAgE DaTaStReAm", .tlen = sizeof("# PaCkAgE DaTaStReAm") - 1},
+    {.kind = NodeStringMapEntry, .line = 13053, .level = 0, .end = 171, .mime = 48, .target = "# abook addressbook file", .tlen = sizeof("# abook addressbook file") - 1},
+    {.kind = NodeStringMapEntry, .line = 12117, .level = 0, .end = 172, .mime = 182, .target = "# xmcd", .tlen = sizeof("# xmcd") - 1},
+    {.kind = NodeStringMapEntry, .line = 15701, .level = 0, .end = 173, .mime = 15, .target = "%!", .tlen = sizeof("%!") - 1},
+    {.kind = NodeStringMapEntry, .line = 15436, .level = 0, .end = 174, .mime = 19, .target = "%FDF-", .tlen = sizeof("%FDF-") - 1},
+    {.kind = NodeStringMapEntry, .line = 15429, .level = 0, .end = 175, .mime = 11, .target = "%PDF-", .tlen = sizeof("%PDF-") - 1},
+    {.kind = NodeStringMapEntry, .line = 15647, .level = 0, .end = 176, .mime = 12, .target = "-----BEGIN PGP MESSAGE-", .tlen = sizeof("-----BEGIN PGP MESSAGE-") - 1},
+    {.kind = NodeStringMapEntry, .line = 15649, .level = 0, .end = 177, .mime = 14, .target = "-----BEGIN PGP SIGNATURE-", .tlen = sizeof("-----BEGIN PGP SIGNATURE-") - 1},
+    {.kind = NodeStringMapEntry, .line = 2631, .level = 0, .end = 178, .mime = 46, .target = ".RMF" "\x00" "\x00" "\x00", .tlen = sizeof(".RMF" "\x00" "\x00" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 8635, .level = 0, .end = 179, .mime = 129, .target = "8BPS", .tlen = sizeof("8BPS") - 1},
+    {.kind = NodeStringMapEntry, .line = 17600, .level = 0, .end = 180, .mime = 103, .target = "<?xml version \"", .tlen = sizeof("<?xml version \"") - 1},
+    {.kind = NodeStringMapEntry, .line = 17603, .level = 0, .end = 181, .mime = 103, .target = "<?xml version=\"", .tlen = sizeof("<?xml version=\"") - 1},
+    {.kind = NodeStringMapEntry, .line = 17609, .level = 0, .end = 182, .mime = 103, .target = "<?xml version='", .tlen = sizeof("<?xml version='") - 1},
+    {.kind = NodeStringMapEntry, .line = 6256, .level = 0, .end = 183, .mime = 85, .target = "<BookFile", .tlen = sizeof("<BookFile") - 1},
+    {.kind = NodeStringMapEntry, .line = 6240, .level = 0, .end = 184, .mime = 85, .target = "<MIFFile", .tlen = sizeof("<MIFFile") - 1},
+    {.kind = NodeStringMapEntry, .line = 6254, .level = 0, .end = 185, .mime = 85, .target = "<MML", .tlen = sizeof("<MML") - 1},
+    {.kind = NodeStringMapEntry, .line = 6268, .level = 0, .end = 186, .mime = 85, .target = "<Maker", .tlen = sizeof("<Maker") - 1},
+    {.kind = NodeStringMapEntry, .line = 6231, .level = 0, .end = 187, .mime = 85, .target = "<MakerFile", .tlen = sizeof("<MakerFile") - 1},
+    {.kind = NodeStringMapEntry, .line = 6251, .level = 0, .end = 188, .mime = 85, .target = "<MakerScreenFont", .tlen = sizeof("<MakerScreenFont") - 1},
+    {.kind = NodeStringMapEntry, .line = 20412, .level = 0, .end = 189, .mime = 94, .target = "<SCRIBUSUTF8NEW Version", .tlen = sizeof("<SCRIBUSUTF8NEW Version") - 1},
+    {.kind = NodeStringMapEntry, .line = 3552, .level = 0, .end = 190, .mime = 131, .target = "AC1.2", .tlen = sizeof("AC1.2") - 1},
+    {.kind = NodeStringMapEntry, .line = 3554, .level = 0, .end = 191, .mime = 131, .target = "AC1.3", .tlen = sizeof("AC1.3") - 1},
+    {.kind = NodeStringMapEntry, .line = 3556, .level = 0, .end = 192, .mime = 131, .target = "AC1.40", .tlen = sizeof("AC1.40") - 1},
+    {.kind = NodeStringMapEntry, .line = 3558, .level = 0, .end = 193, .mime = 131, .target = "AC1.50", .tlen = sizeof("AC1.50") - 1},
+    {.kind = NodeStringMapEntry, .line = 3566, .level = 0, .end = 194, .mime = 131, .target = "AC1001", .tlen = sizeof("AC1001") - 1},
+    {.kind = NodeStringMapEntry, .line = 3568, .level = 0, .end = 195, .mime = 131, .target = "AC1002", .tlen = sizeof("AC1002") - 1},
+    {.kind = NodeStringMapEntry, .line = 3570, .level = 0, .end = 196, .mime = 131, .target = "AC1003", .tlen = sizeof("AC1003") - 1},
+    {.kind = NodeStringMapEntry, .line = 3572, .level = 0, .end = 197, .mime = 131, .target = "AC1004", .tlen = sizeof("AC1004") - 1},
+    {.kind = NodeStringMapEntry, .line = 3574, .level = 0, .end = 198, .mime = 131, .target = "AC1006", .tlen = sizeof("AC1006") - 1},
+    {.kind = NodeStringMapEntry, .line = 3576, .level = 0, .end = 199, .mime = 131, .target = "AC1009", .tlen = sizeof("AC1009") - 1},
+    {.kind = NodeStringMapEntry, .line = 3583, .level = 0, .end = 200, .mime = 131, .target = "AC1012", .tlen = sizeof("AC1012") - 1},
+    {.kind = NodeStringMapEntry, .line = 3585, .level = 0, .end = 201, .mime = 131, .target = "AC1014", .tlen = sizeof("AC1014") - 1},
+    {.kind = NodeStringMapEntry, .line = 3587, .level = 0, .end = 202, .mime = 131, .target = "AC1015", .tlen = sizeof("AC1015") - 1},
+    {.kind = NodeStringMapEntry, .line = 3595, .level = 0, .end = 203, .mime = 131, .target = "AC1018", .tlen = sizeof("AC1018") - 1},
+    {.kind = NodeStringMapEntry, .line = 3597, .level = 0, .end = 204, .mime = 131, .target = "AC1021", .tlen = sizeof("AC1021") - 1},
+    {.kind = NodeStringMapEntry, .line = 3599, .level = 0, .end = 205, .mime = 131, .target = "AC1024", .tlen = sizeof("AC1024") - 1},
+    {.kind = NodeStringMapEntry, .line = 3601, .level = 0, .end = 206, .mime = 131, .target = "AC1027", .tlen = sizeof("AC1027") - 1},
+    {.kind = NodeStringMapEntry, .line = 3560, .level = 0, .end = 207, .mime = 131, .target = "AC2.10", .tlen = sizeof("AC2.10") - 1},
+    {.kind = NodeStringMapEntry, .line = 3562, .level = 0, .end = 208, .mime = 131, .target = "AC2.21", .tlen = sizeof("AC2.21") - 1},
+    {.kind = NodeStringMapEntry, .line = 3564, .level = 0, .end = 209, .mime = 131, .target = "AC2.22", .tlen = sizeof("AC2.22") - 1},
+    {.kind = NodeStringMapEntry, .line = 1027, .level = 0, .end = 210, .mime = 114, .target = "ADIF", .tlen = sizeof("ADIF") - 1},
+    {.kind = NodeStringMapEntry, .line = 4115, .level = 0, .end = 211, .mime = 50, .target = "BZh", .tlen = sizeof("BZh") - 1},
+    {.kind = NodeStringMapEntry, .line = 6104, .level = 0, .end = 212, .mime = 193, .target = "FLV" "\x01", .tlen = sizeof("FLV" "\x01") - 1},
+    {.kind = NodeStringMapEntry, .line = 4763, .level = 0, .end = 213, .mime = 68, .target = "GDBM", .tlen = sizeof("GDBM") - 1},
+    {.kind = NodeStringMapEntry, .line = 8294, .level = 0, .end = 214, .mime = 121, .target = "GIF8", .tlen = sizeof("GIF8") - 1},
+    {.kind = NodeStringMapEntry, .line = 8227, .level = 0, .end = 215, .mime = 135, .target = "II" "\x1a" "\x00" "\x00" "\x00" "HEAPCCDR", .tlen = sizeof("II" "\x1a" "\x00" "\x00" "\x00" "HEAPCCDR") - 1},
+    {.kind = NodeStringMapEntry, .line = 8247, .level = 0, .end = 216, .mime = 128, .target = "II*" "\x00", .tlen = sizeof("II*" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 8237, .level = 0, .end = 217, .mime = 134, .target = "II*" "\x00" "\x10" "\x00" "\x00" "\x00" "CR", .tlen = sizeof("II*" "\x00" "\x10" "\x00" "\x00" "\x00" "CR") - 1},
+    {.kind = NodeStringMapEntry, .line = 8252, .level = 0, .end = 218, .mime = 128, .target = "II+" "\x00", .tlen = sizeof("II+" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 8978, .level = 0, .end = 219, .mime = 142, .target = "IIRO", .tlen = sizeof("IIRO") - 1},
+    {.kind = NodeStringMapEntry, .line = 8980, .level = 0, .end = 220, .mime = 142, .target = "IIRS", .tlen = sizeof("IIRS") - 1},
+    {.kind = NodeStringMapEntry, .line = 3003, .level = 0, .end = 221, .mime = 112, .target = "MAC ", .tlen = sizeof("MAC ") - 1},
+    {.kind = NodeStringMapEntry, .line = 3550, .level = 0, .end = 222, .mime = 131, .target = "MC0.0", .tlen = sizeof("MC0.0") - 1},
+    {.kind = NodeStringMapEntry, .line = 8245, .level = 0, .end = 223, .mime = 128, .target = "MM" "\x00" "*", .tlen = sizeof("MM" "\x00" "*") - 1},
+    {.kind = NodeStringMapEntry, .line = 8250, .level = 0, .end = 224, .mime = 128, .target = "MM" "\x00" "+", .tlen = sizeof("MM" "\x00" "+") - 1},
+    {.kind = NodeStringMapEntry, .line = 8976, .level = 0, .end = 225, .mime = 142, .target = "MMOR", .tlen = sizeof("MMOR") - 1},
+    {.kind = NodeStringMapEntry, .line = 3083, .level = 0, .end = 226, .mime = 117, .target = "MP+", .tlen = sizeof("MP+") - 1},
+    {.kind = NodeStringMapEntry, .line = 13942, .level = 0, .end = 227, .mime = 22, .target = "MSCF" "\x00" "\x00" "\x00" "\x00", .tlen = sizeof("MSCF" "\x00" "\x00" "\x00" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 2596, .level = 0, .end = 228, .mime = 107, .target = "MThd", .tlen = sizeof("MThd") - 1},
+    {.kind = NodeStringMapEntry, .line = 6194, .level = 0, .end = 229, .mime = 25, .target = "OTTO", .tlen = sizeof("OTTO") - 1},
+    {.kind = NodeStringMapEntry, .line = 19763, .level = 0, .end = 230, .mime = 10, .target = "OggS", .tlen = sizeof("OggS") - 1},
+    {.kind = NodeStringMapEntry, .line = 8204, .level = 0, .end = 231, .mime = 148, .target = "P7", .tlen = sizeof("P7") - 1},
+    {.kind = NodeStringMapEntry, .line = 9018, .level = 0, .end = 232, .mime = 143, .target = "PDN3", .tlen = sizeof("PDN3") - 1},
+    {.kind = NodeStringMapEntry, .line = 2016, .level = 0, .end = 233, .mime = 105, .target = "PK\a\bPK" "\x03" "\x04", .tlen = sizeof("PK\a\bPK" "\x03" "\x04") - 1},
+    {.kind = NodeStringMapEntry, .line = 13663, .level = 0, .end = 234, .mime = 8, .target = "PO^Q`", .tlen = sizeof("PO^Q`") - 1},
+    {.kind = NodeStringMapEntry, .line = 16299, .level = 0, .end = 235, .mime = 119, .target = "RF64" "\xff" "\xff" "\xff" "\xff" "WAVEds64", .tlen = sizeof("RF64" "\xff" "\xff" "\xff" "\xff" "WAVEds64") - 1},
+    {.kind = NodeStringMapEntry, .line = 1992, .level = 0, .end = 236, .mime = 92, .target = "Rar!", .tlen = sizeof("Rar!") - 1},
+    {.kind = NodeStringMapEntry, .line = 20628, .level = 0, .end = 237, .mime = 151, .target = "Xcur", .tlen = sizeof("Xcur") - 1},
+    {.kind = NodeStringMapEntry, .line = 8957, .level = 0, .end = 238, .mime = 145, .target = "[BitmapInfo2]", .tlen = sizeof("[BitmapInfo2]") - 1},
+    {.kind = NodeStringMapEntry, .line = 12113, .level = 0, .end = 239, .mime = 81, .target = "[KDE Desktop Entry]", .tlen = sizeof("[KDE Desktop Entry]") - 1},
+    {.kind = NodeStringMapEntry, .line = 2231, .level = 0, .end = 240, .mime = 49, .target = "d8:announce", .tlen = sizeof("d8:announce") - 1},
+    {.kind = NodeStringMapEntry, .line = 17079, .level = 0, .end = 241, .mime = 93, .target = "drpm", .tlen = sizeof("drpm") - 1},
+    {.kind = NodeStringMapEntry, .line = 2947, .level = 0, .end = 242, .mime = 113, .target = "fLaC", .tlen = sizeof("fLaC") - 1},
+    {.kind = NodeStringMapEntry, .line = 19883, .level = 0, .end = 243, .mime = 73, .target = "filedesc://", .tlen = sizeof("filedesc://") - 1},
+    {.kind = NodeStringMapEntry, .line = 6928, .level = 0, .end = 244, .mime = 150, .target = "gimp xcf", .tlen = sizeof("gimp xcf") - 1},
+    {.kind = NodeStringMapEntry, .line = 17098, .level = 0, .end = 245, .mime = 165, .target = "{\\rtf", .tlen = sizeof("{\\rtf") - 1},
+    {.kind = NodeStringMapEntry, .line = 8881, .level = 0, .end = 246, .mime = 71, .target = "\x89" "HDF\r\n" "\x1a" "\n", .tlen = sizeof("\x89" "HDF\r\n" "\x1a" "\n") - 1},
+    {.kind = NodeStringMapEntry, .line = 8261, .level = 0, .end = 247, .mime = 126, .target = "\x89" "PNG\r\n" "\x1a" "\n", .tlen = sizeof("\x89" "PNG\r\n" "\x1a" "\n") - 1},
+    {.kind = NodeStringMapEntry, .line = 1185, .level = 0, .end = 248, .mime = 195, .target = "\x8a" "MNG", .tlen = sizeof("\x8a" "MNG") - 1},
+    {.kind = NodeStringMapEntry, .line = 13989, .level = 0, .end = 249, .mime = 8, .target = "\x94" "\xa6" ".", .tlen = sizeof("\x94" "\xa6" ".") - 1},
+    {.kind = NodeStringMapEntry, .line = 13674, .level = 0, .end = 250, .mime = 8, .target = "\xdb" "\xa5" "-" "\x00", .tlen = sizeof("\xdb" "\xa5" "-" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 13680, .level = 0, .end = 251, .mime = 8, .target = "\xdb" "\xa5" "-" "\x00", .tlen = sizeof("\xdb" "\xa5" "-" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 13668, .level = 0, .end = 252, .mime = 8, .target = "\xdb" "\xa5" "-" "\x00" "\x00" "\x00", .tlen = sizeof("\xdb" "\xa5" "-" "\x00" "\x00" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 18831, .level = 0, .end = 253, .mime = 53, .target = "\xf7" "\x02", .tlen = sizeof("\xf7" "\x02") - 1},
+    {.kind = NodeStringMapEntry, .line = 4242, .level = 0, .end = 254, .mime = 102, .target = "\xfd" "7zXZ" "\x00", .tlen = sizeof("\xfd" "7zXZ" "\x00") - 1},
+    {.kind = NodeStringMapEntry, .line = 13666, .level = 0, .end = 255, .mime = 8, .target = "\xfe" "7" "\x00" "#", .tlen = sizeof("\xfe" "7" "\x00" "#") - 1},
+    {.kind = NodeStringMapEntry, .line = 4109, .level = 0, .end = 256, .mime = 9, .target = "\xff" "\x1f", .tlen = sizeof("\xff" "\x1f") - 1},
+    {.kind = NodeStringEqual, .line = 480, .level = 0, .end = 257, .mime = 189, .offset = 4, .target = "moov", .tlen = sizeof("moov") - 1},
+    {.kind = NodeStringEqual, .line = 486, .level = 0, .end = 258, .mime = 189, .offset = 4, .target = "mdat", .tlen = sizeof("mdat") - 1},
+    {.kind = NodeStringEqual, .line = 494, .level = 0, .end = 259, .mime = 149, .offset = 4, .target = "idsc", .tlen = sizeof("idsc") - 1},
+    {.kind = NodeStringEqual, .line = 498, .level = 0, .end = 260, .mime = 91, .offset = 4, .target = "pckg", .tlen = sizeof("pckg") - 1},
+    {.kind = NodeStringEqual, .line = 502, .level = 0, .end = 275, .offset = 4, .target = "ftyp", .tlen = sizeof("ftyp") - 1},
+    {.kind = NodeStringEqual, .line = 503, .level = 1, .end = 262, .mime = 186, .offset = 8, .target = "isom", .tlen = sizeof("isom") - 1},
+    {.kind = NodeStringEqual, .line = 506, .level = 1, .end = 263, .mime = 186, .offset = 8, .target = "mp41", .tlen = sizeof("mp41") - 1},
+    {.kind = NodeStringEqual, .line = 508, .level = 1, .end = 264, .mime = 186, .offset = 8, .target = "mp42", .tlen = sizeof("mp42") - 1},
+    {.kind = NodeStringEqual, .line = 514, .level = 1, .end = 265, .mime = 183, .offset = 8, .target = "3ge", .tlen = sizeof("3ge") - 1},
+    {.kind = NodeStringEqual, .line = 516, .level = 1, .end = 266, .mime = 183, .offset = 8, .target = "3gg", .tlen = sizeof("3gg") - 1},
+    {.kind = NodeStringEqual, .line = 518, .level = 1, .end = 267, .mime = 183, .offset = 8, .target = "3gp", .tlen = sizeof("3gp") - 1},
+    {.kind = NodeStringEqual, .line = 520, .level = 1, .end = 268, .mime = 183, .offset = 8, .target = "3gs", .tlen = sizeof("3gs") - 1},
+    {.kind = NodeStringEqual, .line = 522, .level = 1, .end = 269, .mime = 184, .offset = 8, .target = "3g2", .tlen = sizeof("3g2") - 1},
+    {.kind = NodeStringEqual, .line = 527, .level = 1, .end = 270, .mime = 186, .offset = 8, .target = "mmp4", .tlen = sizeof("mmp4") - 1},
+    {.kind = NodeStringEqual, .line = 529, .level = 1, .end = 271, .mime = 183, .offset = 8, .target = "avc1", .tlen = sizeof("avc1") - 1},
+    {.kind = NodeStringMatch, .line = 512, .level = 1, .end = 272, .mime = 122, .offset = 8, .target = "jp2", .tlen = sizeof("jp2") - 1, .compare = CompareEq, .flags = 0|CompactWS},
+    {.kind = NodeStringMatch, .line = 531, .level = 1, .end = 273, .mime = 108, .offset = 8, .target = "M4A", .tlen = sizeof("M4A") - 1, .compare = CompareEq, .flags = 0|CompactWS},
+    {.kind = NodeStringMatch, .line = 533, .level = 1, .end = 274, .mime = 186, .offset = 8, .target = "M4V", .tlen = sizeof("M4V") - 1, .compare = CompareEq, .flags = 0|CompactWS},
+    {.kind = NodeStringMatch, .line = 537, .level = 1, .end = 275, .mime = 189, .offset = 8, .target = "qt", .tlen = sizeof("qt") - 1, .compare = CompareEq, .flags = 0|CompactWS},
+    {.kind = NodeStringEqual, .line = 1211, .level = 0, .end = 277, .offset = 0, .target = "<?xml version=\"", .tlen = sizeof("<?xml version=\"") - 1},
+    {.kind = NodeSearch, .line = 1213, .level = 1, .end = 277, .mime = 155, .offset = 20, .target = "<!DOCTYPE X3D", .tlen = sizeof("<!DOCTYPE X3D") - 1, .limit = 1000, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeStringEqual, .line = 1439, .level = 0, .end = 278, .mime = 99, .offset = 257, .target = "ustar" "\x00", .tlen = sizeof("ustar" "\x00") - 1},
+    {.kind = NodeStringEqual, .line = 1441, .level = 0, .end = 279, .mime = 99, .offset = 257, .target = "ustar  " "\x00", .tlen = sizeof("ustar  " "\x00") - 1},
+    {.kind = NodeStringEqual, .line = 2025, .level = 0, .end = 325, .offset = 0, .target = "PK" "\x03" "\x04", .tlen = sizeof("PK" "\x03" "\x04") - 1},
+    {.kind = NodeBeLong, .line = 2026, .level = 1, .end = 287, .offset = 30, .value = 0x6d696d65, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 2027, .level = 2, .end = 282, .mime = 105, .offset = 4, .value = 0x00, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 2029, .level = 2, .end = 283, .mime = 105, .offset = 4, .value = 0x09, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 2031, .level = 2, .end = 284, .mime = 105, .offset = 4, .value = 0x0a, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 2033, .level = 2, .end = 285, .mime = 105, .offset = 4, .value = 0x0b, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 2037, .level = 2, .end = 286, .mime = 105, .offset = 4, .value = 0x14, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2035, .level = 2, .end = 287, .mime = 105, .offset = 0x161, .target = "WINZIP", .tlen = sizeof("WINZIP") - 1},
+    {.kind = NodeLeShort, .line = 2151, .level = 1, .end = 288, .mime = 6, .offset = 26, .indirect = True, .typeFlag = 's', .oper = '+', .operand = 30, .value = 0xcafe, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 2156, .level = 1, .end = 290, .offset = 26, .indirect = True, .typeFlag = 's', .oper = '+', .operand = 30, .value = 0xcafe, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringNotEqual, .line = 2157, .level = 2, .end = 290, .mime = 105, .offset = 26, .target = "\b" "\x00" "\x00" "\x00" "mimetype", .tlen = sizeof("\b" "\x00" "\x00" "\x00" "mimetype") - 1},
+    {.kind = NodeStringEqual, .line = 2044, .level = 1, .end = 322, .offset = 26, .target = "\b" "\x00" "\x00" "\x00" "mimetypeapplication/", .tlen = sizeof("\b" "\x00" "\x00" "\x00" "mimetypeapplication/") - 1},
+    {.kind = NodeStringEqual, .line = 2083, .level = 2, .end = 316, .offset = 50, .target = "vnd.oasis.opendocument.", .tlen = sizeof("vnd.oasis.opendocument.") - 1},
+    {.kind = NodeStringEqual, .line = 2084, .level = 3, .end = 297, .offset = 73, .target = "text", .tlen = sizeof("text") - 1},
+    {.kind = NodeByte, .line = 2085, .level = 4, .end = 294, .mime = 39, .offset = 77, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2087, .level = 4, .end = 295, .mime = 41, .offset = 77, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2089, .level = 4, .end = 296, .mime = 42, .offset = 77, .target = "-web", .tlen = sizeof("-web") - 1},
+    {.kind = NodeStringEqual, .line = 2091, .level = 4, .end = 297, .mime = 40, .offset = 77, .target = "-master", .tlen = sizeof("-master") - 1},
+    {.kind = NodeStringEqual, .line = 2093, .level = 3, .end = 300, .offset = 73, .target = "graphics", .tlen = sizeof("graphics") - 1},
+    {.kind = NodeByte, .line = 2094, .level = 4, .end = 299, .mime = 31, .offset = 81, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2096, .level = 4, .end = 300, .mime = 32, .offset = 81, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2098, .level = 3, .end = 303, .offset = 73, .target = "presentation", .tlen = sizeof("presentation") - 1},
+    {.kind = NodeByte, .line = 2099, .level = 4, .end = 302, .mime = 35, .offset = 85, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2101, .level = 4, .end = 303, .mime = 36, .offset = 85, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2103, .level = 3, .end = 306, .offset = 73, .target = "spreadsheet", .tlen = sizeof("spreadsheet") - 1},
+    {.kind = NodeByte, .line = 2104, .level = 4, .end = 305, .mime = 37, .offset = 84, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2106, .level = 4, .end = 306, .mime = 38, .offset = 84, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2108, .level = 3, .end = 309, .offset = 73, .target = "chart", .tlen = sizeof("chart") - 1},
+    {.kind = NodeByte, .line = 2109, .level = 4, .end = 308, .mime = 26, .offset = 78, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2111, .level = 4, .end = 309, .mime = 27, .offset = 78, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2113, .level = 3, .end = 312, .offset = 73, .target = "formula", .tlen = sizeof("formula") - 1},
+    {.kind = NodeByte, .line = 2114, .level = 4, .end = 311, .mime = 29, .offset = 80, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2116, .level = 4, .end = 312, .mime = 30, .offset = 80, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2118, .level = 3, .end = 313, .mime = 28, .offset = 73, .target = "database", .tlen = sizeof("database") - 1},
+    {.kind = NodeStringEqual, .line = 2120, .level = 3, .end = 316, .offset = 73, .target = "image", .tlen = sizeof("image") - 1},
+    {.kind = NodeByte, .line = 2121, .level = 4, .end = 315, .mime = 33, .offset = 78, .value = 0x2d, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2123, .level = 4, .end = 316, .mime = 34, .offset = 78, .target = "-template", .tlen = sizeof("-template") - 1},
+    {.kind = NodeStringEqual, .line = 2129, .level = 2, .end = 317, .mime = 5, .offset = 50, .target = "epub+zip", .tlen = sizeof("epub+zip") - 1},
+    {.kind = NodeStringNotEqual, .line = 2138, .level = 2, .end = 322, .offset = 50, .target = "epub+zip", .tlen = sizeof("epub+zip") - 1},
+    {.kind = NodeStringNotEqual, .line = 2139, .level = 3, .end = 322, .offset = 50, .target = "vnd.oasis.opendocument.", .tlen = sizeof("vnd.oasis.opendocument.") - 1},
+    {.kind = NodeStringNotEqual, .line = 2140, .level = 4, .end = 322, .offset = 50, .target = "vnd.sun.xml.", .tlen = sizeof("vnd.sun.xml.") - 1},
+    {.kind = NodeStringNotEqual, .line = 2141, .level = 5, .end = 322, .offset = 50, .target = "vnd.kde.", .tlen = sizeof("vnd.kde.") - 1},
+    {.kind = NodeRegex, .line = 2142, .level = 6, .end = 322, .mime = 105, .offset = 38, .target = "[!-OQ-~]+", .tlen = sizeof("[!-OQ-~]+") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 2145, .level = 1, .end = 325, .offset = 26, .target = "\b" "\x00" "\x00" "\x00" "mimetype", .tlen = sizeof("\b" "\x00" "\x00" "\x00" "mimetype") - 1},
+    {.kind = NodeStringNotEqual, .line = 2146, .level = 2, .end = 325, .offset = 38, .target = "application/", .tlen = sizeof("application/") - 1},
+    {.kind = NodeRegex, .line = 2147, .level = 3, .end = 325, .mime = 105, .offset = 38, .target = "[!-OQ-~]+", .tlen = sizeof("[!-OQ-~]+") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 2185, .level = 0, .end = 326, .mime = 9, .offset = 10, .target = "# This is a shell archive", .tlen = sizeof("# This is a shell archive") - 1},
+    {.kind = NodeStringEqual, .line = 2521, .level = 0, .end = 335, .offset = 0, .target = ".snd", .tlen = sizeof(".snd") - 1},
+    {.kind = NodeBeLong, .line = 2522, .level = 1, .end = 328, .mime = 106, .offset = 12, .value = 1, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2524, .level = 1, .end = 329, .mime = 106, .offset = 12, .value = 2, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2526, .level = 1, .end = 330, .mime = 106, .offset = 12, .value = 3, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2528, .level = 1, .end = 331, .mime = 106, .offset = 12, .value = 4, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2530, .level = 1, .end = 332, .mime = 106, .offset = 12, .value = 5, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2532, .level = 1, .end = 333, .mime = 106, .offset = 12, .value = 6, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2534, .level = 1, .end = 334, .mime = 106, .offset = 12, .value = 7, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeBeLong, .line = 2546, .level = 1, .end = 335, .mime = 111, .offset = 12, .value = 23, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 2806, .level = 0, .end = 337, .offset = 0, .target = "ID3", .tlen = sizeof("ID3") - 1},
+    {.kind = NodeIndirect, .line = 2813, .level = 1, .end = 337, .offset = 6, .indirect = True, .typeFlag = 'I'},
+    {.kind = NodeStringEqual, .line = 4006, .level = 0, .end = 339, .offset = 0, .target = "<?php /* Smarty version", .tlen = sizeof("<?php /* Smarty version") - 1},
+    {.kind = NodeRegex, .line = 4007, .level = 1, .end = 339, .mime = 174, .offset = 24, .target = "[0-9.]+", .tlen = sizeof("[0-9.]+") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 4226, .level = 0, .end = 341, .offset = 0, .target = "7z" "\xbc" "\xaf" "'" "\x1c", .tlen = sizeof("7z" "\xbc" "\xaf" "'" "\x1c") - 1},
+    {.kind = NodeAlways, .line = 4228, .level = 1, .end = 341, .mime = 47},
+    {.kind = NodeStringEqual, .line = 4246, .level = 0, .end = 343, .offset = 0, .target = "LRZI", .tlen = sizeof("LRZI") - 1},
+    {.kind = NodeAlways, .line = 4248, .level = 1, .end = 343, .mime = 82},
+    {.kind = NodeStringEqual, .line = 4718, .level = 0, .end = 345, .offset = 0, .target = "RaS", .tlen = sizeof("RaS") - 1},
+    {.kind = NodeStringEqual, .line = 4721, .level = 1, .end = 345, .mime = 17, .offset = 3, .target = "3", .tlen = sizeof("3") - 1},
+    {.kind = NodeStringEqual, .line = 4727, .level = 0, .end = 347, .offset = 1, .target = "SaR", .tlen = sizeof("SaR") - 1},
+    {.kind = NodeStringMapEntry, .line = 4730, .level = 1, .end = 347, .mime = 17, .target = "3", .tlen = sizeof("3") - 1},
+    {.kind = NodeStringEqual, .line = 5149, .level = 0, .end = 348, .mime = 87, .offset = 4, .target = "Standard Jet DB", .tlen = sizeof("Standard Jet DB") - 1},
+    {.kind = NodeStringEqual, .line = 5151, .level = 0, .end = 349, .mime = 87, .offset = 4, .target = "Standard ACE DB", .tlen = sizeof("Standard ACE DB") - 1},
+    {.kind = NodeStringEqual, .line = 6071, .level = 0, .end = 353, .offset = 0, .target = "FCS3.0", .tlen = sizeof("FCS3.0") - 1},
+    {.kind = NodeStringMapEntry, .line = 6088, .level = 1, .end = 351, .mime = 97, .target = "C", .tlen = sizeof("C") - 1},
+    {.kind = NodeStringMapEntry, .line = 6086, .level = 1, .end = 352, .mime = 97, .target = "F", .tlen = sizeof("F") - 1},
+    {.kind = NodeStringMapEntry, .line = 6090, .level = 1, .end = 353, .mime = 97, .target = "Z", .tlen = sizeof("Z") - 1},
+    {.kind = NodeStringEqual, .line = 6203, .level = 0, .end = 354, .mime = 24, .offset = 34, .target = "LP", .tlen = sizeof("LP") - 1},
+    {.kind = NodeStringEqual, .line = 8186, .level = 0, .end = 357, .offset = 0, .target = "P4", .tlen = sizeof("P4") - 1},
+    {.kind = NodeRegex, .line = 8188, .level = 1, .end = 357, .offset = 3, .target = "=[0-9]{1,50} ", .tlen = sizeof("=[0-9]{1,50} ") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 8189, .level = 2, .end = 357, .mime = 146, .offset = 3, .target = "= [0-9]{1,50}", .tlen = sizeof("= [0-9]{1,50}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 8192, .level = 0, .end = 360, .offset = 0, .target = "P5", .tlen = sizeof("P5") - 1},
+    {.kind = NodeRegex, .line = 8194, .level = 1, .end = 360, .offset = 3, .target = "=[0-9]{1,50} ", .tlen = sizeof("=[0-9]{1,50} ") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 8195, .level = 2, .end = 360, .mime = 147, .offset = 3, .target = "= [0-9]{1,50}", .tlen = sizeof("= [0-9]{1,50}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 8198, .level = 0, .end = 363, .offset = 0, .target = "P6", .tlen = sizeof("P6") - 1},
+    {.kind = NodeRegex, .line = 8200, .level = 1, .end = 363, .offset = 3, .target = "=[0-9]{1,50} ", .tlen = sizeof("=[0-9]{1,50} ") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 8201, .level = 2, .end = 363, .mime = 148, .offset = 3, .target = "= [0-9]{1,50}", .tlen = sizeof("= [0-9]{1,50}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 8373, .level = 0, .end = 365, .offset = 0, .target = "AWBM", .tlen = sizeof("AWBM") - 1},
+    {.kind = NodeLeShort, .line = 8374, .level = 1, .end = 365, .mime = 133, .offset = 4, .value = 1981, .compare = CompareLt, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 8393, .level = 0, .end = 372, .offset = 0, .target = "BM", .tlen = sizeof("BM") - 1},
+    {.kind = NodeLeShort, .line = 8394, .level = 1, .end = 367, .mime = 141, .offset = 14, .value = 12, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 8398, .level = 1, .end = 368, .mime = 141, .offset = 14, .value = 64, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 8402, .level = 1, .end = 369, .mime = 141, .offset = 14, .value = 40, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 8407, .level = 1, .end = 370, .mime = 141, .offset = 14, .value = 124, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 8412, .level = 1, .end = 371, .mime = 141, .offset = 14, .value = 108, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeLeShort, .line = 8417, .level = 1, .end = 372, .mime = 141, .offset = 14, .value = 128, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 8525, .level = 0, .end = 373, .mime = 4, .offset = 128, .target = "DICM", .tlen = sizeof("DICM") - 1},
+    {.kind = NodeStringEqual, .line = 8806, .level = 0, .end = 378, .offset = 0, .target = "AT&TFORM", .tlen = sizeof("AT&TFORM") - 1},
+    {.kind = NodeStringEqual, .line = 8807, .level = 1, .end = 375, .mime = 130, .offset = 12, .target = "DJVM", .tlen = sizeof("DJVM") - 1},
+    {.kind = NodeStringEqual, .line = 8809, .level = 1, .end = 376, .mime = 130, .offset = 12, .target = "DJVU", .tlen = sizeof("DJVU") - 1},
+    {.kind = NodeStringEqual, .line = 8811, .level = 1, .end = 377, .mime = 130, .offset = 12, .target = "DJVI", .tlen = sizeof("DJVI") - 1},
+    {.kind = NodeStringEqual, .line = 8813, .level = 1, .end = 378, .mime = 130, .offset = 12, .target = "THUM", .tlen = sizeof("THUM") - 1},
+    {.kind = NodeStringEqual, .line = 8883, .level = 0, .end = 379, .mime = 71, .offset = 512, .target = "\x89" "HDF\r\n" "\x1a" "\n", .tlen = sizeof("\x89" "HDF\r\n" "\x1a" "\n") - 1},
+    {.kind = NodeStringEqual, .line = 8885, .level = 0, .end = 380, .mime = 71, .offset = 1024, .target = "\x89" "HDF\r\n" "\x1a" "\n", .tlen = sizeof("\x89" "HDF\r\n" "\x1a" "\n") - 1},
+    {.kind = NodeStringEqual, .line = 8887, .level = 0, .end = 381, .mime = 71, .offset = 2048, .target = "\x89" "HDF\r\n" "\x1a" "\n", .tlen = sizeof("\x89" "HDF\r\n" "\x1a" "\n") - 1},
+    {.kind = NodeStringEqual, .line = 8889, .level = 0, .end = 382, .mime = 71, .offset = 4096, .target = "\x89" "HDF\r\n" "\x1a" "\n", .tlen = sizeof("\x89" "HDF\r\n" "\x1a" "\n") - 1},
+    {.kind = NodeStringEqual, .line = 9026, .level = 0, .end = 384, .offset = 0, .target = "RIFF", .tlen = sizeof("RIFF") - 1},
+    {.kind = NodeStringEqual, .line = 9027, .level = 1, .end = 384, .mime = 132, .offset = 8, .target = "WEBP", .tlen = sizeof("WEBP") - 1},
+    {.kind = NodeStringEqual, .line = 9381, .level = 0, .end = 389, .offset = 0, .target = "\x00" "\x00" "\x00" "\fjP  \r\n" "\x87" "\n", .tlen = sizeof("\x00" "\x00" "\x00" "\fjP  \r\n" "\x87" "\n") - 1},
+    {.kind = NodeStringEqual, .line = 9387, .level = 1, .end = 386, .mime = 122, .offset = 20, .target = "jp2 ", .tlen = sizeof("jp2 ") - 1},
+    {.kind = NodeStringEqual, .line = 9389, .level = 1, .end = 387, .mime = 125, .offset = 20, .target = "jpx ", .tlen = sizeof("jpx ") - 1},
+    {.kind = NodeStringEqual, .line = 9391, .level = 1, .end = 388, .mime = 124, .offset = 20, .target = "jpm ", .tlen = sizeof("jpm ") - 1},
+    {.kind = NodeStringEqual, .line = 9393, .level = 1, .end = 389, .mime = 185, .offset = 20, .target = "mjp2", .tlen = sizeof("mjp2") - 1},
+    {.kind = NodeStringEqual, .line = 9761, .level = 0, .end = 397, .offset = 0, .target = "LPKSHHRH", .tlen = sizeof("LPKSHHRH") - 1},
+    {.kind = NodeByte, .line = 9763, .level = 1, .end = 397, .offset = 16, .value = 0, .compare = CompareEq, .mask = 252},
+    {.kind = NodeBeQuad, .line = 9765, .level = 2, .end = 397, .offset = 24, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeQuad, .line = 9766, .level = 3, .end = 397, .offset = 32, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeQuad, .line = 9767, .level = 4, .end = 397, .offset = 40, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeQuad, .line = 9768, .level = 5, .end = 397, .offset = 48, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeQuad, .line = 9769, .level = 6, .end = 397, .offset = 56, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeBeQuad, .line = 9770, .level = 7, .end = 397, .mime = 9, .offset = 64, .value = 0, .compare = CompareGt, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 10032, .level = 0, .end = 402, .offset = 0, .target = "SBMBAKUP_", .tlen = sizeof("SBMBAKUP_") - 1},
+    {.kind = NodeAlways, .line = 10033, .level = 1, .end = 402},
+    {.kind = NodeStringEqual, .line = 10034, .level = 2, .end = 402, .offset = 14, .target = "_", .tlen = sizeof("_") - 1},
+    {.kind = NodeSearch, .line = 10044, .level = 3, .end = 402, .offset = 535, .target = "U" "\xaa", .tlen = sizeof("U" "\xaa") - 1, .limit = 17, .flags = 0},
+    {.kind = NodeIndirect, .line = 10045, .level = 4, .end = 402, .offset = -512, .outerRelative = True},
+    {.kind = NodeStringEqual, .line = 10049, .level = 0, .end = 407, .offset = 0, .target = "DOSEMU" "\x00", .tlen = sizeof("DOSEMU" "\x00") - 1},
+    {.kind = NodeLeShort, .line = 10050, .level = 1, .end = 407, .offset = 0x27E, .value = 0xAA55, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 10052, .level = 2, .end = 407, .offset = 19, .value = 128, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 10053, .level = 3, .end = 407, .offset = 19, .indirect = True, .typeFlag = 'b', .oper = '-', .operand = 1, .value = 0x0, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeIndirect, .line = 10057, .level = 4, .end = 407, .offset = 128},
+    {.kind = NodeStringEqual, .line = 10062, .level = 0, .end = 410, .offset = 0, .target = "PNCIHISK" "\x00", .tlen = sizeof("PNCIHISK" "\x00") - 1},
+    {.kind = NodeSearch, .line = 10064, .level = 1, .end = 410, .offset = 509, .target = "U" "\xaa" "\xeb", .tlen = sizeof("U" "\xaa" "\xeb") - 1, .limit = 1026, .flags = 0},
+    {.kind = NodeIndirect, .line = 10065, .level = 2, .end = 410, .offset = -1, .outerRelative = True},
+    {.kind = NodeStringEqual, .line = 11703, .level = 0, .end = 411, .mime = 78, .offset = 32769, .target = "CD001", .tlen = sizeof("CD001") - 1},
+    {.kind = NodeStringEqual, .line = 11716, .level = 0, .end = 412, .mime = 78, .offset = 37633, .target = "CD001", .tlen = sizeof("CD001") - 1},
+    {.kind = NodeStringEqual, .line = 12147, .level = 0, .end = 416, .offset = 0, .target = "<?xml", .tlen = sizeof("<?xml") - 1},
+    {.kind = NodeSearch, .line = 12148, .level = 1, .end = 416, .offset = 20, .target = " xmlns=", .tlen = sizeof(" xmlns=") - 1, .limit = 400, .flags = 0},
+    {.kind = NodeRegex, .line = 12149, .level = 2, .end = 415, .mime = 20, .offset = 0, .outerRelative = True, .target = "['\"]http://earth.google.com/kml", .tlen = sizeof("['\"]http://earth.google.com/kml") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 12161, .level = 2, .end = 416, .mime = 20, .offset = 0, .outerRelative = True, .target = "['\"]http://www.opengis.net/kml", .tlen = sizeof("['\"]http://www.opengis.net/kml") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeStringEqual, .line = 12169, .level = 0, .end = 419, .offset = 0, .target = "PK" "\x03" "\x04", .tlen = sizeof("PK" "\x03" "\x04") - 1},
+    {.kind = NodeByte, .line = 12170, .level = 1, .end = 419, .offset = 4, .value = 0x14, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 12171, .level = 2, .end = 419, .mime = 21, .offset = 30, .target = "doc.kml", .tlen = sizeof("doc.kml") - 1},
+    {.kind = NodeStringEqual, .line = 13168, .level = 0, .end = 424, .offset = 0, .target = "@", .tlen = sizeof("@") - 1},
+    {.kind = NodeStringMatch, .line = 13169, .level = 1, .end = 421, .mime = 171, .offset = 1, .target = " echo off", .tlen = sizeof(" echo off") - 1, .compare = CompareEq, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringMatch, .line = 13171, .level = 1, .end = 422, .mime = 171, .offset = 1, .target = "echo off", .tlen = sizeof("echo off") - 1, .compare = CompareEq, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringMatch, .line = 13173, .level = 1, .end = 423, .mime = 171, .offset = 1, .target = "rem", .tlen = sizeof("rem") - 1, .compare = CompareEq, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringMatch, .line = 13175, .level = 1, .end = 424, .mime = 171, .offset = 1, .target = "set ", .tlen = sizeof("set ") - 1, .compare = CompareEq, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringEqual, .line = 13203, .level = 0, .end = 427, .offset = 0, .target = "MZ", .tlen = sizeof("MZ") - 1},
+    {.kind = NodeStringEqual, .line = 13412, .level = 1, .end = 426, .mime = 105, .offset = 0x1e, .target = "Copyright 1989-1990 PKWARE Inc.", .tlen = sizeof("Copyright 1989-1990 PKWARE Inc.") - 1},
+    {.kind = NodeStringEqual, .line = 13415, .level = 1, .end = 427, .mime = 105, .offset = 0x1e, .target = "PKLITE Copr.", .tlen = sizeof("PKLITE Copr.") - 1},
+    {.kind = NodeStringEqual, .line = 13652, .level = 0, .end = 428, .mime = 8, .offset = 2080, .target = "Microsoft Word 6.0 Document", .tlen = sizeof("Microsoft Word 6.0 Document") - 1},
+    {.kind = NodeStringEqual, .line = 13654, .level = 0, .end = 429, .mime = 8, .offset = 2080, .target = "Documento Microsoft Word 6", .tlen = sizeof("Documento Microsoft Word 6") - 1},
+    {.kind = NodeStringEqual, .line = 13657, .level = 0, .end = 430, .mime = 8, .offset = 2112, .target = "MSWordDoc", .tlen = sizeof("MSWordDoc") - 1},
+    {.kind = NodeStringEqual, .line = 13670, .level = 0, .end = 431, .mime = 8, .offset = 512, .target = "\xec" "\xa5" "\xc1", .tlen = sizeof("\xec" "\xa5" "\xc1") - 1},
+    {.kind = NodeStringEqual, .line = 13677, .level = 0, .end = 432, .mime = 23, .offset = 2080, .target = "Microsoft Excel 5.0 Worksheet", .tlen = sizeof("Microsoft Excel 5.0 Worksheet") - 1},
+    {.kind = NodeStringEqual, .line = 13683, .level = 0, .end = 433, .mime = 23, .offset = 2080, .target = "Foglio di lavoro Microsoft Exce", .tlen = sizeof("Foglio di lavoro Microsoft Exce") - 1},
+    {.kind = NodeStringEqual, .line = 13687, .level = 0, .end = 434, .mime = 23, .offset = 2114, .target = "Biff5", .tlen = sizeof("Biff5") - 1},
+    {.kind = NodeStringEqual, .line = 13690, .level = 0, .end = 435, .mime = 23, .offset = 2121, .target = "Biff5", .tlen = sizeof("Biff5") - 1},
+    {.kind = NodeStringEqual, .line = 13981, .level = 0, .end = 438, .offset = 0, .target = "\xd0" "\xcf" "\x11" "\xe0" "\xa1" "\xb1" "\x1a" "\xe1", .tlen = sizeof("\xd0" "\xcf" "\x11" "\xe0" "\xa1" "\xb1" "\x1a" "\xe1") - 1},
+    {.kind = NodeStringEqual, .line = 13984, .level = 1, .end = 437, .mime = 8, .offset = 546, .target = "bjbj", .tlen = sizeof("bjbj") - 1},
+    {.kind = NodeStringEqual, .line = 13986, .level = 1, .end = 438, .mime = 8, .offset = 546, .target = "jbjb", .tlen = sizeof("jbjb") - 1},
+    {.kind = NodeStringEqual, .line = 13992, .level = 0, .end = 439, .mime = 8, .offset = 512, .target = "R" "\x00" "o" "\x00" "o" "\x00" "t" "\x00" " " "\x00" "E" "\x00" "n" "\x00" "t" "\x00" "r" "\x00" "y", .tlen = sizeof("R" "\x00" "o" "\x00" "o" "\x00" "t" "\x00" " " "\x00" "E" "\x00" "n" "\x00" "t" "\x00" "r" "\x00" "y") - 1},
+    {.kind = NodeStringEqual, .line = 14021, .level = 0, .end = 441, .offset = 0, .target = "ITOLITLS", .tlen = sizeof("ITOLITLS") - 1},
+    {.kind = NodeAlways, .line = 14022, .level = 1, .end = 441, .mime = 86},
+    {.kind = NodeStringEqual, .line = 14093, .level = 0, .end = 448, .offset = 0, .target = "PK" "\x03" "\x04", .tlen = sizeof("PK" "\x03" "\x04") - 1},
+    {.kind = NodeRegex, .line = 14096, .level = 1, .end = 448, .offset = 0x1E, .target = "[Content_Types].xml|_rels/.rels", .tlen = sizeof("[Content_Types].xml|_rels/.rels") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeSearch, .line = 14100, .level = 2, .end = 448, .offset = 18, .indirect = True, .typeFlag = 'l', .oper = '+', .operand = 49, .target = "PK" "\x03" "\x04", .tlen = sizeof("PK" "\x03" "\x04") - 1, .limit = 2000, .flags = 0},
+    {.kind = NodeSearch, .line = 14103, .level = 3, .end = 448, .offset = 26, .outerRelative = True, .target = "PK" "\x03" "\x04", .tlen = sizeof("PK" "\x03" "\x04") - 1, .limit = 1000, .flags = 0},
+    {.kind = NodeStringMatch, .line = 14107, .level = 4, .end = 446, .mime = 45, .offset = 26, .outerRelative = True, .target = "word/", .tlen = sizeof("word/") - 1, .compare = CompareEq, .flags = 0},
+    {.kind = NodeStringMatch, .line = 14109, .level = 4, .end = 447, .mime = 43, .offset = 26, .outerRelative = True, .target = "ppt/", .tlen = sizeof("ppt/") - 1, .compare = CompareEq, .flags = 0},
+    {.kind = NodeStringMatch, .line = 14111, .level = 4, .end = 448, .mime = 44, .offset = 26, .outerRelative = True, .target = "xl/", .tlen = sizeof("xl/") - 1, .compare = CompareEq, .flags = 0},
+    {.kind = NodeStringEqual, .line = 15645, .level = 0, .end = 449, .mime = 13, .offset = 2, .target = "---BEGIN PGP PUBLIC KEY BLOCK-", .tlen = sizeof("---BEGIN PGP PUBLIC KEY BLOCK-") - 1},
+    {.kind = NodeStringEqual, .line = 16070, .level = 0, .end = 454, .offset = 0, .target = "RIFF", .tlen = sizeof("RIFF") - 1},
+    {.kind = NodeStringEqual, .line = 16095, .level = 1, .end = 451, .mime = 119, .offset = 8, .target = "WAVE", .tlen = sizeof("WAVE") - 1},
+    {.kind = NodeStringEqual, .line = 16100, .level = 1, .end = 452, .mime = 136, .offset = 8, .target = "CDRA", .tlen = sizeof("CDRA") - 1},
+    {.kind = NodeStringEqual, .line = 16102, .level = 1, .end = 453, .mime = 136, .offset = 8, .target = "CDR6", .tlen = sizeof("CDR6") - 1},
+    {.kind = NodeStringEqual, .line = 16106, .level = 1, .end = 454, .mime = 197, .offset = 8, .target = "AVI ", .tlen = sizeof("AVI ") - 1},
+    {.kind = NodeStringEqual, .line = 17009, .level = 0, .end = 473, .offset = 60, .target = "RINEX", .tlen = sizeof("RINEX") - 1},
+    {.kind = NodeSearch, .line = 17010, .level = 1, .end = 457, .offset = 80, .target = "XXRINEXB", .tlen = sizeof("XXRINEXB") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17012, .level = 2, .end = 457, .mime = 156},
+    {.kind = NodeSearch, .line = 17014, .level = 1, .end = 459, .offset = 80, .target = "XXRINEXD", .tlen = sizeof("XXRINEXD") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17016, .level = 2, .end = 459, .mime = 160},
+    {.kind = NodeSearch, .line = 17018, .level = 1, .end = 461, .offset = 80, .target = "XXRINEXC", .tlen = sizeof("XXRINEXC") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17020, .level = 2, .end = 461, .mime = 157},
+    {.kind = NodeSearch, .line = 17022, .level = 1, .end = 463, .offset = 80, .target = "XXRINEXH", .tlen = sizeof("XXRINEXH") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17024, .level = 2, .end = 463, .mime = 159},
+    {.kind = NodeSearch, .line = 17026, .level = 1, .end = 465, .offset = 80, .target = "XXRINEXG", .tlen = sizeof("XXRINEXG") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17028, .level = 2, .end = 465, .mime = 159},
+    {.kind = NodeSearch, .line = 17030, .level = 1, .end = 467, .offset = 80, .target = "XXRINEXL", .tlen = sizeof("XXRINEXL") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17032, .level = 2, .end = 467, .mime = 159},
+    {.kind = NodeSearch, .line = 17034, .level = 1, .end = 469, .offset = 80, .target = "XXRINEXM", .tlen = sizeof("XXRINEXM") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17036, .level = 2, .end = 469, .mime = 158},
+    {.kind = NodeSearch, .line = 17038, .level = 1, .end = 471, .offset = 80, .target = "XXRINEXN", .tlen = sizeof("XXRINEXN") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17040, .level = 2, .end = 471, .mime = 159},
+    {.kind = NodeSearch, .line = 17042, .level = 1, .end = 473, .offset = 80, .target = "XXRINEXO", .tlen = sizeof("XXRINEXO") - 1, .limit = 256, .flags = 0},
+    {.kind = NodeAlways, .line = 17044, .level = 2, .end = 473, .mime = 160},
+    {.kind = NodeStringEqual, .line = 17256, .level = 0, .end = 478, .offset = 0, .target = "HEADER   ", .tlen = sizeof("HEADER   ") - 1},
+    {.kind = NodeRegex, .line = 17257, .level = 1, .end = 478, .offset = 0, .outerRelative = True, .target = "^.{40}", .tlen = sizeof("^.{40}") - 1, .limit = 1 * 80, .flags = 0},
+    {.kind = NodeRegex, .line = 17258, .level = 2, .end = 478, .offset = 0, .outerRelative = True, .target = "[0-9]{2}-[A-Z]{3}-[0-9]{2} {3}", .tlen = sizeof("[0-9]{2}-[A-Z]{3}-[0-9]{2} {3}") - 1, .limit = 1 * 80, .flags = 0},
+    {.kind = NodeRegex, .line = 17259, .level = 3, .end = 478, .offset = 0, .outerRelative = True, .target = "[A-Z0-9]{4}.{14}$", .tlen = sizeof("[A-Z0-9]{4}.{14}$") - 1, .limit = 1 * 80, .flags = 0|RegexBegin},
+    {.kind = NodeRegex, .line = 17260, .level = 4, .end = 478, .mime = 120, .offset = 0, .outerRelative = True, .target = "[A-Z0-9]{4}", .tlen = sizeof("[A-Z0-9]{4}") - 1, .limit = 1 * 80, .flags = 0},
+    {.kind = NodeStringEqual, .line = 17531, .level = 0, .end = 482, .offset = 0, .target = "<?xml version=\"", .tlen = sizeof("<?xml version=\"") - 1},
+    {.kind = NodeStringGreater, .line = 17532, .level = 1, .end = 482, .offset = 15, .target = "\x00", .tlen = sizeof("\x00") - 1},
+    {.kind = NodeSearch, .line = 17533, .level = 2, .end = 481, .mime = 127, .offset = 19, .target = "<svg", .tlen = sizeof("<svg") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 17535, .level = 2, .end = 482, .mime = 69, .offset = 19, .target = "<gnc-v2", .tlen = sizeof("<gnc-v2") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeStringEqual, .line = 17539, .level = 0, .end = 485, .offset = 0, .target = "<?xml version=\"", .tlen = sizeof("<?xml version=\"") - 1},
+    {.kind = NodeStringGreater, .line = 17540, .level = 1, .end = 485, .offset = 15, .target = "\x00", .tlen = sizeof("\x00") - 1},
+    {.kind = NodeSearch, .line = 17541, .level = 2, .end = 485, .mime = 104, .offset = 19, .target = "<urlset", .tlen = sizeof("<urlset") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeStringEqual, .line = 17552, .level = 0, .end = 488, .offset = 0, .target = "<?xml version=\"", .tlen = sizeof("<?xml version=\"") - 1},
+    {.kind = NodeStringGreater, .line = 17553, .level = 1, .end = 488, .offset = 15, .target = "\x00", .tlen = sizeof("\x00") - 1},
+    {.kind = NodeSearch, .line = 17554, .level = 2, .end = 488, .mime = 163, .offset = 19, .target = "<!doctype html", .tlen = sizeof("<!doctype html") - 1, .limit = 4096, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringEqual, .line = 17556, .level = 0, .end = 491, .offset = 0, .target = "<?xml version='", .tlen = sizeof("<?xml version='") - 1},
+    {.kind = NodeStringGreater, .line = 17557, .level = 1, .end = 491, .offset = 15, .target = "\x00", .tlen = sizeof("\x00") - 1},
+    {.kind = NodeSearch, .line = 17558, .level = 2, .end = 491, .mime = 163, .offset = 19, .target = "<!doctype html", .tlen = sizeof("<!doctype html") - 1, .limit = 4096, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringEqual, .line = 17560, .level = 0, .end = 494, .offset = 0, .target = "<?xml version=\"", .tlen = sizeof("<?xml version=\"") - 1},
+    {.kind = NodeStringGreater, .line = 17561, .level = 1, .end = 494, .offset = 15, .target = "\x00", .tlen = sizeof("\x00") - 1},
+    {.kind = NodeSearch, .line = 17562, .level = 2, .end = 494, .mime = 163, .offset = 19, .target = "<html", .tlen = sizeof("<html") - 1, .limit = 4096, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeStringEqual, .line = 18249, .level = 0, .end = 497, .offset = 0, .target = "PSDB" "\x00", .tlen = sizeof("PSDB" "\x00") - 1},
+    {.kind = NodeStringEqual, .line = 18250, .level = 1, .end = 497, .offset = 126, .target = "SQLite format 3", .tlen = sizeof("SQLite format 3") - 1},
+    {.kind = NodeIndirect, .line = 18251, .level = 2, .end = 497, .offset = -15, .outerRelative = True},
+    {.kind = NodeStringEqual, .line = 18844, .level = 0, .end = 498, .mime = 100, .offset = 2, .target = "\x00" "\x11", .tlen = sizeof("\x00" "\x11") - 1},
+    {.kind = NodeStringEqual, .line = 18847, .level = 0, .end = 499, .mime = 100, .offset = 2, .target = "\x00" "\x12", .tlen = sizeof("\x00" "\x12") - 1},
+    {.kind = NodeStringEqual, .line = 20355, .level = 0, .end = 500, .mime = 72, .offset = 512, .target = "R" "\x00" "o" "\x00" "o" "\x00" "t" "\x00", .tlen = sizeof("R" "\x00" "o" "\x00" "o" "\x00" "t" "\x00") - 1},
+    {.kind = NodeStringEqual, .line = 20386, .level = 0, .end = 502, .offset = 0, .target = "DOC", .tlen = sizeof("DOC") - 1},
+    {.kind = NodeByte, .line = 20387, .level = 1, .end = 502, .mime = 74, .offset = 43, .value = 0x14, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 20391, .level = 0, .end = 504, .offset = 0, .target = "DOC", .tlen = sizeof("DOC") - 1},
+    {.kind = NodeByte, .line = 20392, .level = 1, .end = 504, .mime = 75, .offset = 43, .value = 0x15, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 20395, .level = 0, .end = 506, .offset = 0, .target = "DOC", .tlen = sizeof("DOC") - 1},
+    {.kind = NodeByte, .line = 20396, .level = 1, .end = 506, .mime = 76, .offset = 43, .value = 0x16, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeStringEqual, .line = 20765, .level = 0, .end = 508, .offset = 22, .fromEnd = True, .inTail = True, .target = "PK" "\x05" "\x06", .tlen = sizeof("PK" "\x05" "\x06") - 1},
+    {.kind = NodeStringMatch, .line = 20766, .level = 1, .end = 508, .mime = 105, .offset = 6, .fromEnd = True, .inTail = True, .readsTail = True, .indirect = True, .typeFlag = 'l', .target = "PK" "\x01" "\x02", .tlen = sizeof("PK" "\x01" "\x02") - 1, .compare = CompareEq, .flags = 0},
+    {.kind = NodeStringNotEqual, .line = 1523, .level = 0, .end = 511, .offset = 0, .target = "<arch>\ndebian", .tlen = sizeof("<arch>\ndebian") - 1},
+    {.kind = NodeStringEqual, .line = 1524, .level = 1, .end = 510, .mime = 18, .offset = 8, .target = "debian-split", .tlen = sizeof("debian-split") - 1},
+    {.kind = NodeStringEqual, .line = 1526, .level = 1, .end = 511, .mime = 18, .offset = 8, .target = "debian-binary", .tlen = sizeof("debian-binary") - 1},
+    {.kind = NodeStringMatch, .line = 500, .level = 0, .end = 512, .mime = 122, .offset = 4, .target = "jP", .tlen = sizeof("jP") - 1, .compare = CompareEq, .flags = 0|CompactWS},
+    {.kind = NodeStringMatch, .line = 1204, .level = 0, .end = 513, .mime = 154, .offset = 0, .target = "#VRML V1.0 ascii", .tlen = sizeof("#VRML V1.0 ascii") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 1206, .level = 0, .end = 514, .mime = 154, .offset = 0, .target = "#VRML V2.0 utf8", .tlen = sizeof("#VRML V2.0 utf8") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3914, .level = 0, .end = 515, .mime = 177, .offset = 0, .target = "#! /bin/sh", .tlen = sizeof("#! /bin/sh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3916, .level = 0, .end = 516, .mime = 177, .offset = 0, .target = "#! /bin/sh", .tlen = sizeof("#! /bin/sh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3919, .level = 0, .end = 517, .mime = 177, .offset = 0, .target = "#! /bin/csh", .tlen = sizeof("#! /bin/csh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3923, .level = 0, .end = 518, .mime = 177, .offset = 0, .target = "#! /bin/ksh", .tlen = sizeof("#! /bin/ksh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3925, .level = 0, .end = 519, .mime = 177, .offset = 0, .target = "#! /bin/ksh", .tlen = sizeof("#! /bin/ksh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3928, .level = 0, .end = 520, .mime = 177, .offset = 0, .target = "#! /bin/tcsh", .tlen = sizeof("#! /bin/tcsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3930, .level = 0, .end = 521, .mime = 177, .offset = 0, .target = "#! /usr/bin/tcsh", .tlen = sizeof("#! /usr/bin/tcsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3932, .level = 0, .end = 522, .mime = 177, .offset = 0, .target = "#! /usr/local/tcsh", .tlen = sizeof("#! /usr/local/tcsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3934, .level = 0, .end = 523, .mime = 177, .offset = 0, .target = "#! /usr/local/bin/tcsh", .tlen = sizeof("#! /usr/local/bin/tcsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3939, .level = 0, .end = 524, .mime = 177, .offset = 0, .target = "#! /bin/zsh", .tlen = sizeof("#! /bin/zsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3941, .level = 0, .end = 525, .mime = 177, .offset = 0, .target = "#! /usr/bin/zsh", .tlen = sizeof("#! /usr/bin/zsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3943, .level = 0, .end = 526, .mime = 177, .offset = 0, .target = "#! /usr/local/bin/zsh", .tlen = sizeof("#! /usr/local/bin/zsh") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3945, .level = 0, .end = 527, .mime = 177, .offset = 0, .target = "#! /usr/local/bin/ash", .tlen = sizeof("#! /usr/local/bin/ash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3947, .level = 0, .end = 528, .mime = 177, .offset = 0, .target = "#! /usr/local/bin/ae", .tlen = sizeof("#! /usr/local/bin/ae") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3949, .level = 0, .end = 529, .mime = 172, .offset = 0, .target = "#! /bin/nawk", .tlen = sizeof("#! /bin/nawk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3951, .level = 0, .end = 530, .mime = 172, .offset = 0, .target = "#! /usr/bin/nawk", .tlen = sizeof("#! /usr/bin/nawk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3953, .level = 0, .end = 531, .mime = 172, .offset = 0, .target = "#! /usr/local/bin/nawk", .tlen = sizeof("#! /usr/local/bin/nawk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3955, .level = 0, .end = 532, .mime = 168, .offset = 0, .target = "#! /bin/gawk", .tlen = sizeof("#! /bin/gawk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3957, .level = 0, .end = 533, .mime = 168, .offset = 0, .target = "#! /usr/bin/gawk", .tlen = sizeof("#! /usr/bin/gawk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3959, .level = 0, .end = 534, .mime = 168, .offset = 0, .target = "#! /usr/local/bin/gawk", .tlen = sizeof("#! /usr/local/bin/gawk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3962, .level = 0, .end = 535, .mime = 167, .offset = 0, .target = "#! /bin/awk", .tlen = sizeof("#! /bin/awk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3964, .level = 0, .end = 536, .mime = 167, .offset = 0, .target = "#! /usr/bin/awk", .tlen = sizeof("#! /usr/bin/awk") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3972, .level = 0, .end = 537, .mime = 177, .offset = 0, .target = "#! /bin/bash", .tlen = sizeof("#! /bin/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3974, .level = 0, .end = 538, .mime = 177, .offset = 0, .target = "#! /bin/bash", .tlen = sizeof("#! /bin/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3976, .level = 0, .end = 539, .mime = 177, .offset = 0, .target = "#! /usr/bin/bash", .tlen = sizeof("#! /usr/bin/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3978, .level = 0, .end = 540, .mime = 177, .offset = 0, .target = "#! /usr/bin/bash", .tlen = sizeof("#! /usr/bin/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3980, .level = 0, .end = 541, .mime = 177, .offset = 0, .target = "#! /usr/local/bash", .tlen = sizeof("#! /usr/local/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3982, .level = 0, .end = 542, .mime = 177, .offset = 0, .target = "#! /usr/local/bash", .tlen = sizeof("#! /usr/local/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3984, .level = 0, .end = 543, .mime = 177, .offset = 0, .target = "#! /usr/local/bin/bash", .tlen = sizeof("#! /usr/local/bin/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 3986, .level = 0, .end = 544, .mime = 177, .offset = 0, .target = "#! /usr/local/bin/bash", .tlen = sizeof("#! /usr/local/bin/bash") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 13033, .level = 0, .end = 545, .mime = 162, .offset = 0, .target = "BEGIN:VCALENDAR", .tlen = sizeof("BEGIN:VCALENDAR") - 1, .compare = CompareEq, .flags = 0|MatchLower},
+    {.kind = NodeStringMatch, .line = 13035, .level = 0, .end = 546, .mime = 181, .offset = 0, .target = "BEGIN:VCARD", .tlen = sizeof("BEGIN:VCARD") - 1, .compare = CompareEq, .flags = 0|MatchLower},
+    {.kind = NodeStringMatch, .line = 20401, .level = 0, .end = 547, .mime = 66, .offset = 0, .target = "<map version", .tlen = sizeof("<map version") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeStringMatch, .line = 20406, .level = 0, .end = 548, .mime = 67, .offset = 0, .target = "<map version=\"freeplane", .tlen = sizeof("<map version=\"freeplane") - 1, .compare = CompareEq, .flags = 0|IgnoreWS},
+    {.kind = NodeMpegFrames, .line = 0, .level = 0, .end = 549, .mime = 109, .offset = 0},
+    {.kind = NodeSearch, .line = 3991, .level = 0, .end = 550, .mime = 174, .offset = 0, .target = "<?php", .tlen = sizeof("<?php") - 1, .limit = 1, .flags = 0|MatchLower},
+    {.kind = NodeSearch, .line = 3994, .level = 0, .end = 551, .mime = 174, .offset = 0, .target = "<?\n", .tlen = sizeof("<?\n") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 3996, .level = 0, .end = 552, .mime = 174, .offset = 0, .target = "<?\r", .tlen = sizeof("<?\r") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 3998, .level = 0, .end = 553, .mime = 174, .offset = 0, .target = "#! /usr/local/bin/php", .tlen = sizeof("#! /usr/local/bin/php") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 4001, .level = 0, .end = 554, .mime = 174, .offset = 0, .target = "#! /usr/bin/php", .tlen = sizeof("#! /usr/bin/php") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 6246, .level = 0, .end = 555, .mime = 85, .offset = 0, .target = "<MakerDictionary", .tlen = sizeof("<MakerDictionary") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 8168, .level = 0, .end = 558, .offset = 0, .target = "P1", .tlen = sizeof("P1") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeRegex, .line = 8170, .level = 1, .end = 558, .offset = 3, .target = "=[0-9]{1,50} ", .tlen = sizeof("=[0-9]{1,50} ") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 8171, .level = 2, .end = 558, .mime = 146, .offset = 3, .target = "= [0-9]{1,50}", .tlen = sizeof("= [0-9]{1,50}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeSearch, .line = 8174, .level = 0, .end = 561, .offset = 0, .target = "P2", .tlen = sizeof("P2") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeRegex, .line = 8176, .level = 1, .end = 561, .offset = 3, .target = "=[0-9]{1,50} ", .tlen = sizeof("=[0-9]{1,50} ") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 8177, .level = 2, .end = 561, .mime = 147, .offset = 3, .target = "= [0-9]{1,50}", .tlen = sizeof("= [0-9]{1,50}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeSearch, .line = 8180, .level = 0, .end = 564, .offset = 0, .target = "P3", .tlen = sizeof("P3") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeRegex, .line = 8182, .level = 1, .end = 564, .offset = 3, .target = "=[0-9]{1,50} ", .tlen = sizeof("=[0-9]{1,50} ") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 8183, .level = 2, .end = 564, .mime = 148, .offset = 3, .target = "= [0-9]{1,50}", .tlen = sizeof("= [0-9]{1,50}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeSearch, .line = 8431, .level = 0, .end = 565, .mime = 152, .offset = 0, .target = "/* XPM */", .tlen = sizeof("/* XPM */") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 9214, .level = 0, .end = 566, .mime = 7, .offset = 0, .target = "#!/bin/node", .tlen = sizeof("#!/bin/node") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 9216, .level = 0, .end = 567, .mime = 7, .offset = 0, .target = "#!/usr/bin/node", .tlen = sizeof("#!/usr/bin/node") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 9218, .level = 0, .end = 568, .mime = 7, .offset = 0, .target = "#!/bin/nodejs", .tlen = sizeof("#!/bin/nodejs") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 9220, .level = 0, .end = 569, .mime = 7, .offset = 0, .target = "#!/usr/bin/nodejs", .tlen = sizeof("#!/usr/bin/nodejs") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 9222, .level = 0, .end = 570, .mime = 7, .offset = 0, .target = "#!/usr/bin/env node", .tlen = sizeof("#!/usr/bin/env node") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 9224, .level = 0, .end = 571, .mime = 7, .offset = 0, .target = "#!/usr/bin/env nodejs", .tlen = sizeof("#!/usr/bin/env nodejs") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 12249, .level = 0, .end = 572, .mime = 166, .offset = 0, .target = "<TeXmacs|", .tlen = sizeof("<TeXmacs|") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 12280, .level = 0, .end = 573, .mime = 170, .offset = 0, .target = "#! /usr/bin/lua", .tlen = sizeof("#! /usr/bin/lua") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 12282, .level = 0, .end = 574, .mime = 170, .offset = 0, .target = "#! /usr/local/bin/lua", .tlen = sizeof("#! /usr/local/bin/lua") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 12284, .level = 0, .end = 575, .mime = 170, .offset = 0, .target = "#!/usr/bin/env lua", .tlen = sizeof("#!/usr/bin/env lua") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 12286, .level = 0, .end = 576, .mime = 170, .offset = 0, .target = "#! /usr/bin/env lua", .tlen = sizeof("#! /usr/bin/env lua") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15489, .level = 0, .end = 577, .mime = 173, .offset = 0, .target = "eval \"exec /bin/perl", .tlen = sizeof("eval \"exec /bin/perl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15491, .level = 0, .end = 578, .mime = 173, .offset = 0, .target = "eval \"exec /usr/bin/perl", .tlen = sizeof("eval \"exec /usr/bin/perl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15493, .level = 0, .end = 579, .mime = 173, .offset = 0, .target = "eval \"exec /usr/local/bin/perl", .tlen = sizeof("eval \"exec /usr/local/bin/perl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15495, .level = 0, .end = 580, .mime = 173, .offset = 0, .target = "eval '(exit $?0)' && eval 'exec", .tlen = sizeof("eval '(exit $?0)' && eval 'exec") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15497, .level = 0, .end = 581, .mime = 173, .offset = 0, .target = "#!/usr/bin/env perl", .tlen = sizeof("#!/usr/bin/env perl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15499, .level = 0, .end = 582, .mime = 173, .offset = 0, .target = "#! /usr/bin/env perl", .tlen = sizeof("#! /usr/bin/env perl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15501, .level = 0, .end = 584, .offset = 0, .target = "#!", .tlen = sizeof("#!") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeRegex, .line = 15502, .level = 1, .end = 584, .mime = 173, .offset = 0, .target = "^#!.*/bin/perl$", .tlen = sizeof("^#!.*/bin/perl$") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeSearch, .line = 15927, .level = 0, .end = 585, .mime = 175, .offset = 0, .target = "#! /usr/bin/python", .tlen = sizeof("#! /usr/bin/python") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 15929, .level = 0, .end = 586, .mime = 175, .offset = 0, .target = "#! /usr/local/bin/python", .tlen = sizeof("#! /usr/local/bin/python") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 15931, .level = 0, .end = 587, .mime = 175, .offset = 0, .target = "#!/usr/bin/env python", .tlen = sizeof("#!/usr/bin/env python") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 15933, .level = 0, .end = 588, .mime = 175, .offset = 0, .target = "#! /usr/bin/env python", .tlen = sizeof("#! /usr/bin/env python") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 17115, .level = 0, .end = 589, .mime = 176, .offset = 0, .target = "#! /usr/bin/ruby", .tlen = sizeof("#! /usr/bin/ruby") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 17117, .level = 0, .end = 590, .mime = 176, .offset = 0, .target = "#! /usr/local/bin/ruby", .tlen = sizeof("#! /usr/local/bin/ruby") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 17119, .level = 0, .end = 591, .mime = 176, .offset = 0, .target = "#!/usr/bin/env ruby", .tlen = sizeof("#!/usr/bin/env ruby") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 17121, .level = 0, .end = 592, .mime = 176, .offset = 0, .target = "#! /usr/bin/env ruby", .tlen = sizeof("#! /usr/bin/env ruby") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 17597, .level = 0, .end = 593, .mime = 103, .offset = 0, .target = "<?xml", .tlen = sizeof("<?xml") - 1, .limit = 1, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17615, .level = 0, .end = 594, .mime = 103, .offset = 0, .target = "<?xml", .tlen = sizeof("<?xml") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 17618, .level = 0, .end = 595, .mime = 103, .offset = 0, .target = "<?XML", .tlen = sizeof("<?XML") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 18780, .level = 0, .end = 596, .mime = 178, .offset = 0, .target = "#! /usr/bin/tcl", .tlen = sizeof("#! /usr/bin/tcl") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 18782, .level = 0, .end = 597, .mime = 178, .offset = 0, .target = "#! /usr/local/bin/tcl", .tlen = sizeof("#! /usr/local/bin/tcl") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 18784, .level = 0, .end = 598, .mime = 178, .offset = 0, .target = "#!/usr/bin/env tcl", .tlen = sizeof("#!/usr/bin/env tcl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 18786, .level = 0, .end = 599, .mime = 178, .offset = 0, .target = "#! /usr/bin/env tcl", .tlen = sizeof("#! /usr/bin/env tcl") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 18788, .level = 0, .end = 600, .mime = 178, .offset = 0, .target = "#! /usr/bin/wish", .tlen = sizeof("#! /usr/bin/wish") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 18790, .level = 0, .end = 601, .mime = 178, .offset = 0, .target = "#! /usr/local/bin/wish", .tlen = sizeof("#! /usr/local/bin/wish") - 1, .limit = 1, .flags = 0|IgnoreWS},
+    {.kind = NodeSearch, .line = 18792, .level = 0, .end = 602, .mime = 178, .offset = 0, .target = "#!/usr/bin/env wish", .tlen = sizeof("#!/usr/bin/env wish") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 18794, .level = 0, .end = 603, .mime = 178, .offset = 0, .target = "#! /usr/bin/env wish", .tlen = sizeof("#! /usr/bin/env wish") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 18852, .level = 0, .end = 604, .mime = 180, .offset = 0, .target = "\\input texinfo", .tlen = sizeof("\\input texinfo") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeSearch, .line = 18854, .level = 0, .end = 605, .mime = 169, .offset = 0, .target = "This is Info file", .tlen = sizeof("This is Info file") - 1, .limit = 1, .flags = 0},
+    {.kind = NodeRegex, .line = 15938, .level = 0, .end = 606, .mime = 175, .offset = 0, .target = "^from\\s+(\\w|\\.)+\\s+import.*$", .tlen = sizeof("^from\\s+(\\w|\\.)+\\s+import.*$") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 15965, .level = 0, .end = 608, .offset = 0, .target = "^( |\\t){0,50}def {1,50}[a-zA-Z]{1,100}", .tlen = sizeof("^( |\\t){0,50}def {1,50}[a-zA-Z]{1,100}") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 15966, .level = 1, .end = 608, .mime = 175, .offset = 0, .outerRelative = True, .target = " {0,50}\\(([a-zA-Z]|,| ){1,255}\\):$", .tlen = sizeof(" {0,50}\\(([a-zA-Z]|,| ){1,255}\\):$") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 17127, .level = 0, .end = 611, .offset = 0, .target = "^[ \t]*require[ \t]'[A-Za-z_/]+'", .tlen = sizeof("^[ \t]*require[ \t]'[A-Za-z_/]+'") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 17128, .level = 1, .end = 611, .offset = 0, .target = "include [A-Z]|def [a-z]| do$", .tlen = sizeof("include [A-Z]|def [a-z]| do$") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 17129, .level = 2, .end = 611, .mime = 176, .offset = 0, .target = "^[ \t]*end([ \t]*[;#].*)?$", .tlen = sizeof("^[ \t]*end([ \t]*[;#].*)?$") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 17131, .level = 0, .end = 614, .offset = 0, .target = "^[ \t]*(class|module)[ \t][A-Z]", .tlen = sizeof("^[ \t]*(class|module)[ \t][A-Z]") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 17132, .level = 1, .end = 614, .offset = 0, .target = "(modul|includ)e [A-Z]|def [a-z]", .tlen = sizeof("(modul|includ)e [A-Z]|def [a-z]") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 17133, .level = 2, .end = 614, .mime = 176, .offset = 0, .target = "^[ \t]*end([ \t]*[;#].*)?$", .tlen = sizeof("^[ \t]*end([ \t]*[;#].*)?$") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeRegex, .line = 20065, .level = 0, .end = 637, .offset = 0, .target = "\\`(\r\n|;|[[]|" "\xff" "\xfe" ")", .tlen = sizeof("\\`(\r\n|;|[[]|" "\xff" "\xfe" ")") - 1, .limit = 0, .flags = 0|RegexBegin},
+    {.kind = NodeSearch, .line = 20067, .level = 1, .end = 637, .offset = 0, .outerRelative = True, .target = "[", .tlen = sizeof("[") - 1, .limit = 8192, .flags = 0},
+    {.kind = NodeBeQuad, .line = 20115, .level = 2, .end = 618, .offset = 0, .outerRelative = True, .value = 0x0056004500520053, .compare = CompareEq, .mask = 0xFFdfFFdfFFdfFFdf},
+    {.kind = NodeBeQuad, .line = 20117, .level = 3, .end = 618, .mime = 95, .offset = 0, .outerRelative = True, .value = 0x0049004f004e005d, .compare = CompareEq, .mask = 0xFFdfFFdfFFdfFFff},
+    {.kind = NodeBeQuad, .line = 20120, .level = 2, .end = 620, .offset = 0, .outerRelative = True, .value = 0x0053005400520049, .compare = CompareEq, .mask = 0xFFdfFFdfFFdfFFdf},
+    {.kind = NodeBeQuad, .line = 20122, .level = 3, .end = 620, .mime = 95, .offset = 0, .outerRelative = True, .value = 0x004e00470053005D, .compare = CompareEq, .mask = 0xFFdfFFdfFFdfFFff},
+    {.kind = NodeAlways, .line = 20125, .level = 2, .end = 625},
+    {.kind = NodeSearch, .line = 20126, .level = 3, .end = 625, .offset = 0, .outerRelative = True, .target = "[", .tlen = sizeof("[") - 1, .limit = 8192, .flags = 0},
+    {.kind = NodeBeQuad, .line = 20131, .level = 4, .end = 624, .offset = 0, .outerRelative = True, .value = 0x0056004500520053, .compare = CompareEq, .mask = 0xFFdfFFdfFFdfFFdf},
+    {.kind = NodeBeQuad, .line = 20133, .level = 5, .end = 624, .mime = 95, .offset = 0, .outerRelative = True, .value = 0x0049004f004e005d, .compare = CompareEq, .mask = 0xFFdfFFdfFFdfFFff},
+    {.kind = NodeStringMatch, .line = 20128, .level = 4, .end = 625, .mime = 95, .offset = 0, .outerRelative = True, .target = "version", .tlen = sizeof("version") - 1, .compare = CompareEq, .flags = 0|MatchLower},
+    {.kind = NodeRegex, .line = 20070, .level = 2, .end = 628, .offset = 0, .outerRelative = True, .target = "^(autorun)]\r\n", .tlen = sizeof("^(autorun)]\r\n") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeByte, .line = 20071, .level = 3, .end = 627, .mime = 101, .offset = 0, .outerRelative = True, .value = 0x5b, .compare = CompareEq, .mask = 0xffffffff},
+    {.kind = NodeByte, .line = 20075, .level = 3, .end = 628, .mime = 95, .offset = 0, .outerRelative = True, .value = 0x5b, .compare = CompareEq|CompareNot, .mask = 0xffffffff},
+    {.kind = NodeRegex, .line = 20079, .level = 2, .end = 629, .mime = 95, .offset = 0, .outerRelative = True, .target = "^(version|strings)]", .tlen = sizeof("^(version|strings)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20083, .level = 2, .end = 630, .mime = 164, .offset = 0, .outerRelative = True, .target = "^(WinsockCRCList|OEMCPL)]", .tlen = sizeof("^(WinsockCRCList|OEMCPL)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20088, .level = 2, .end = 631, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(.ShellClassInfo|DeleteOnCopy|LocalizedFileNames)]", .tlen = sizeof("^(.ShellClassInfo|DeleteOnCopy|LocalizedFileNames)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20092, .level = 2, .end = 632, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(don't load)]", .tlen = sizeof("^(don't load)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20094, .level = 2, .end = 633, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(ndishlp\\$|protman\\$|NETBEUI\\$)]", .tlen = sizeof("^(ndishlp\\$|protman\\$|NETBEUI\\$)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20098, .level = 2, .end = 634, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(windows|Compatibility|embedding)]", .tlen = sizeof("^(windows|Compatibility|embedding)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20101, .level = 2, .end = 635, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(boot|386enh|drivers)]", .tlen = sizeof("^(boot|386enh|drivers)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20104, .level = 2, .end = 636, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(SafeList)]", .tlen = sizeof("^(SafeList)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeRegex, .line = 20107, .level = 2, .end = 637, .mime = 101, .offset = 0, .outerRelative = True, .target = "^(boot loader)]", .tlen = sizeof("^(boot loader)]") - 1, .limit = 0, .flags = 0|RegexNoCase},
+    {.kind = NodeSearch, .line = 15942, .level = 0, .end = 639, .offset = 0, .target = "def __init__", .tlen = sizeof("def __init__") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 15943, .level = 1, .end = 639, .mime = 175, .offset = 0, .outerRelative = True, .target = "self", .tlen = sizeof("self") - 1, .limit = 64, .flags = 0},
+    {.kind = NodeSearch, .line = 15958, .level = 0, .end = 642, .offset = 0, .target = "try:", .tlen = sizeof("try:") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeRegex, .line = 15959, .level = 1, .end = 641, .mime = 175, .offset = 0, .outerRelative = True, .target = "^\\s*except.*:", .tlen = sizeof("^\\s*except.*:") - 1, .limit = 0, .flags = 0},
+    {.kind = NodeSearch, .line = 15961, .level = 1, .end = 642, .mime = 175, .offset = 0, .outerRelative = True, .target = "finally:", .tlen = sizeof("finally:") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 17570, .level = 0, .end = 643, .mime = 163, .offset = 0, .target = "<!doctype html", .tlen = sizeof("<!doctype html") - 1, .limit = 4096, .flags = 0|CompactWS|MatchLower},
+    {.kind = NodeSearch, .line = 17573, .level = 0, .end = 644, .mime = 163, .offset = 0, .target = "<head", .tlen = sizeof("<head") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17576, .level = 0, .end = 645, .mime = 163, .offset = 0, .target = "<title", .tlen = sizeof("<title") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17579, .level = 0, .end = 646, .mime = 163, .offset = 0, .target = "<html", .tlen = sizeof("<html") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17582, .level = 0, .end = 647, .mime = 163, .offset = 0, .target = "<script", .tlen = sizeof("<script") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17585, .level = 0, .end = 648, .mime = 163, .offset = 0, .target = "<style", .tlen = sizeof("<style") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17588, .level = 0, .end = 649, .mime = 163, .offset = 0, .target = "<table", .tlen = sizeof("<table") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 17591, .level = 0, .end = 650, .mime = 163, .offset = 0, .target = "<a href=", .tlen = sizeof("<a href=") - 1, .limit = 4096, .flags = 0|IgnoreWS|MatchLower},
+    {.kind = NodeSearch, .line = 18858, .level = 0, .end = 651, .mime = 179, .offset = 0, .target = "\\input", .tlen = sizeof("\\input") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18861, .level = 0, .end = 652, .mime = 179, .offset = 0, .target = "\\begin", .tlen = sizeof("\\begin") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18864, .level = 0, .end = 653, .mime = 179, .offset = 0, .target = "\\section", .tlen = sizeof("\\section") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18867, .level = 0, .end = 654, .mime = 179, .offset = 0, .target = "\\setlength", .tlen = sizeof("\\setlength") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18870, .level = 0, .end = 655, .mime = 179, .offset = 0, .target = "\\documentstyle", .tlen = sizeof("\\documentstyle") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18873, .level = 0, .end = 656, .mime = 179, .offset = 0, .target = "\\chapter", .tlen = sizeof("\\chapter") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18876, .level = 0, .end = 657, .mime = 179, .offset = 0, .target = "\\documentclass", .tlen = sizeof("\\documentclass") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18879, .level = 0, .end = 658, .mime = 179, .offset = 0, .target = "\\relax", .tlen = sizeof("\\relax") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18882, .level = 0, .end = 659, .mime = 179, .offset = 0, .target = "\\contentsline", .tlen = sizeof("\\contentsline") - 1, .limit = 4096, .flags = 0},
+    {.kind = NodeSearch, .line = 18885, .level = 0, .end = 660, .mime = 179, .offset = 0, .target = "% -*-latex-*-", .tlen = sizeof("% -*-latex-*-") - 1, .limit = 4096, .flags = 0},
+};
+static const size_t refNodeCount = 660;
@@ -25,26 +25,39 @@
 */
 
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <getopt.h>
+#include <pthread.h>
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
 
 #include "mimemagic.h"
+#include "counters.h"
 
 //======================================================================
 
-/*  We allow the special mime type of 'unrecognised'.
+/*  We allow the special mime type of 'unrecognised', for -1 from
+    getMimeType(), and 'none' for 0, when more data wouldn't help.
 */
 static void
 usage()
 {
-    fprintf(stderr, "Usage: run_test: -f FILE [-m MIME] [-p | -P int]\n");
+    fprintf(stderr, "Usage: run_test: -f FILE [-m MIME] [-p | -P int] [-L usecs] [-e] [-s] [-H bytes] [-I INFO] [-R START-END]\n"
+                    "       run_test: -c [-b KB] [-P int] [-f FILE] FILE...\n"
+                    "       run_test: -B [-P int] [-f FILE] FILE...\n"
+                    "       run_test: -D [-f FILE] FILE...\n"
+                    "       run_test: -W [-f FILE] FILE...\n"
+                    "       run_test: -K [-P int] [-N starts] [-f FILE] FILE...\n"
+                    "       run_test: -E [-f FILE] FILE...\n"
+                    "       run_test: -T int -f FILE\n"
+                    "       run_test: -S SAMPLES [FILE...]\n");
 }
 
 //======================================================================
@@ -88,7 +101,7 @@ readfile(const char* path, Byte** buf, size_t* len)
 
 
 
-static void
+static double
 reportTime(
     const char*      testFile,
     struct timespec* start,
@@ -96,22 +109,1041 @@ reportTime(
     size_t           count
     )
 {
-    time_t secs  = stop->tv_sec - start->tv_sec;
-    long   nsecs = stop->tv_nsec - start->tv_nsec;
-    double tm;
+    time_t secs  = stop->tv_sec - start->tv_sec;
+    long   nsecs = stop->tv_nsec - start->tv_nsec;
+    double tm;
+
+    while (nsecs < 0)
+    {
+        secs -= 1;
+        nsecs += 1000000000;
+    }
+
+    tm = (1000000 * (secs + nsecs / 1000000000.0)) / count;
+
+    printf("%s: time %.1f usecs\n", testFile, tm);
+    return tm;
+}
+
+
+//======================================================================
+
+/*  The cold cache mode. Between calls we evict the data caches by
+    walking a large buffer, and the instruction cache and the branch
+    predictors by running a large switch with unpredictable branches.
+    This resembles a server that does a lot of other work between
+    classifications.
+*/
+
+#define EVICT1(n)   case n: acc = (acc ^ (n)) * 0x9E3779B97F4A7C15ULL + (acc >> ((n) % 29 + 1)); break;
+#define EVICT4(n)   EVICT1(n) EVICT1(n + 1) EVICT1(n + 2) EVICT1(n + 3)
+#define EVICT16(n)  EVICT4(n) EVICT4(n + 4) EVICT4(n + 8) EVICT4(n + 12)
+#define EVICT64(n)  EVICT16(n) EVICT16(n + 16) EVICT16(n + 32) EVICT16(n + 48)
+
+static volatile uint64_t evictSink;
+
+static void
+evictCode(uint64_t seed)
+{
+    // About 20KB of code with a jump table selected at random.
+    uint64_t acc = seed;
+    uint64_t rnd = seed | 1;
+    int      i;
+
+    for (i = 0; i < 8192; ++i)
+    {
+        rnd ^= rnd << 13;
+        rnd ^= rnd >> 7;
+        rnd ^= rnd << 17;
+
+        switch (rnd & 1023)
+        {
+        EVICT64(0)   EVICT64(64)  EVICT64(128) EVICT64(192)
+        EVICT64(256) EVICT64(320) EVICT64(384) EVICT64(448)
+        EVICT64(512) EVICT64(576) EVICT64(640) EVICT64(704)
+        EVICT64(768) EVICT64(832) EVICT64(896) EVICT64(960)
+        }
+
+        // A data dependent branch to scramble the global history.
+        if (acc & 0x100)
+        {
+            acc += i;
+        }
+    }
+
+    evictSink = acc;
+}
+
+
+
+static void
+evictData(Byte* evict, size_t evictLen)
+{
+    // Write then read every cache line.
+    uint64_t acc = 0;
+    size_t   i;
+
+    for (i = 0; i < evictLen; i += 64)
+    {
+        evict[i] += 1;
+    }
+
+    for (i = 0; i < evictLen; i += 64)
+    {
+        acc += evict[i];
+    }
+
+    evictSink = acc;
+}
+
+
+
+static double
+elapsed(const struct timespec* start, const struct timespec* stop)
+{
+    return (stop->tv_sec - start->tv_sec) * 1e6 + (stop->tv_nsec - start->tv_nsec) / 1e3;
+}
+
+
+
+static int
+compareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+
+static void
+coldPerf(const char** files, size_t numFiles, size_t rounds, size_t evictKB)
+{
+    /*  In each round the files are taken in a random order. Each gets one
+        call after the caches have been evicted and then some back to back
+        calls for the warm time. We report the medians in usecs.
+    */
+    static const size_t WarmCalls = 10;
+
+    Byte**      bufs  = calloc(numFiles, sizeof(Byte*));
+    size_t*     lens  = calloc(numFiles, sizeof(size_t));
+    size_t*     order = calloc(numFiles, sizeof(size_t));
+    double*     cold  = calloc(numFiles * rounds, sizeof(double));
+    double*     warm  = calloc(numFiles * rounds, sizeof(double));
+    size_t      evictLen = evictKB * 1024;
+    Byte*       evict = malloc(evictLen);
+    const char* mime;
+    size_t      r, i, j;
+
+    memset(evict, 0, evictLen);
+    srand(time(NULL));
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        readfile(files[i], &bufs[i], &lens[i]);
+        order[i] = i;
+    }
+
+    for (r = 0; r < rounds; ++r)
+    {
+        // Fisher-Yates shuffle
+        for (i = numFiles; i > 1; --i)
+        {
+            size_t k = rand() % i;
+            size_t t = order[i - 1];
+            order[i - 1] = order[k];
+            order[k] = t;
+        }
+
+        for (j = 0; j < numFiles; ++j)
+        {
+            struct timespec start;
+            struct timespec stop;
+
+            i = order[j];
+
+            evictData(evict, evictLen);
+            evictCode(rand());
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            getMimeType(bufs[i], lens[i], &mime, MimeMagicNone);
+            clock_gettime(CLOCK_MONOTONIC, &stop);
+            cold[i * rounds + r] = elapsed(&start, &stop);
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (size_t w = 0; w < WarmCalls; ++w)
+            {
+                getMimeType(bufs[i], lens[i], &mime, MimeMagicNone);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &stop);
+            warm[i * rounds + r] = elapsed(&start, &stop) / WarmCalls;
+        }
+    }
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        double c, w;
+
+        qsort(cold + i * rounds, rounds, sizeof(double), compareDouble);
+        qsort(warm + i * rounds, rounds, sizeof(double), compareDouble);
+
+        c = cold[i * rounds + rounds / 2];
+        w = warm[i * rounds + rounds / 2];
+
+        printf("%s: cold %.1f usecs warm %.1f usecs ratio %.1f\n",
+               files[i], c, w, w > 0? c / w : 0.0);
+        free(bufs[i]);
+    }
+
+    free(bufs);
+    free(lens);
+    free(order);
+    free(cold);
+    free(warm);
+    free(evict);
+}
+
+static void
+batchPerf(const char** files, size_t numFiles, size_t rounds)
+{
+    /*  The files are repeated to make a batch of small objects, each cut
+        to its first 4KB, too many to stay in the cache. We compare a loop
+        of getMimeType() calls with getMimeTypeBatch() and check that they
+        agree.
+    */
+    static const size_t Objects = 16384;
+    static const size_t MaxLen  = 4096;
+
+    const Byte**    bufs   = calloc(Objects, sizeof(Byte*));
+    size_t*         lens   = calloc(Objects, sizeof(size_t));
+    const char**    mimes1 = calloc(Objects, sizeof(char*));
+    const char**    mimes2 = calloc(Objects, sizeof(char*));
+    int*            rslts1 = calloc(Objects, sizeof(int));
+    int*            rslts2 = calloc(Objects, sizeof(int));
+    Byte**          data   = calloc(numFiles, sizeof(Byte*));
+    size_t*         dlens  = calloc(numFiles, sizeof(size_t));
+    double          loop   = 0;
+    double          batch  = 0;
+    size_t          r, i;
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        readfile(files[i], &data[i], &dlens[i]);
+    }
+
+    // Each object has its own copy so that the batch doesn't fit in the cache.
+    for (i = 0; i < Objects; ++i)
+    {
+        Byte* copy;
+
+        lens[i] = dlens[i % numFiles] < MaxLen? dlens[i % numFiles] : MaxLen;
+        copy    = malloc(lens[i] + 1);
+        memcpy(copy, data[i % numFiles], lens[i]);
+        bufs[i] = copy;
+    }
+
+    for (r = 0; r < rounds; ++r)
+    {
+        struct timespec start;
+        struct timespec stop;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < Objects; ++i)
+        {
+            rslts1[i] = getMimeType(bufs[i], lens[i], &mimes1[i], MimeMagicNone);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        loop += elapsed(&start, &stop);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        getMimeTypeBatch(bufs, lens, Objects, mimes2, rslts2, MimeMagicNone);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        batch += elapsed(&start, &stop);
+    }
+
+    for (i = 0; i < Objects; ++i)
+    {
+        if (rslts1[i] != rslts2[i] || mimes1[i] != mimes2[i])
+        {
+            printf("Failed: %s in a batch gives %s, not %s\n", files[i % numFiles],
+                   mimes2[i] ? mimes2[i] : "unrecognised",
+                   mimes1[i] ? mimes1[i] : "unrecognised");
+            exit(1);
+        }
+    }
+
+    printf("loop %.0f objects/sec, batch %.0f objects/sec, speedup %.2f\n",
+           Objects * rounds / loop * 1e6, Objects * rounds / batch * 1e6, loop / batch);
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        free(data[i]);
+    }
+
+    for (i = 0; i < Objects; ++i)
+    {
+        free((Byte*)bufs[i]);
+    }
+
+    free(bufs);
+    free(lens);
+    free(mimes1);
+    free(mimes2);
+    free(rslts1);
+    free(rslts2);
+    free(data);
+    free(dlens);
+}
+
+//======================================================================
+
+static void
+formatInfo(const MimeMagicInfo* info, char* text, size_t size)
+{
+    // For example "400x144, 8 bits, 2 frames, 1500 ms".
+    int n = snprintf(text, size, "%ux%u, %u bits", info->width, info->height, info->depth);
+
+    if (info->frames)
+    {
+        n += snprintf(text + n, size - n, ", %u frames", info->frames);
+    }
+
+    if (info->milliseconds)
+    {
+        snprintf(text + n, size - n, ", %llu ms", info->milliseconds);
+    }
+}
+
+//======================================================================
+
+typedef struct TraceStep
+{
+    const MimeMagicTraceEntry* entry;
+    unsigned long long cycles;      // since the step before
+} TraceStep;
+
+
+
+static int
+compareSteps(const void* a, const void* b)
+{
+    const TraceStep* sa = (const TraceStep*)a;
+    const TraceStep* sb = (const TraceStep*)b;
+
+    return sa->cycles < sb->cycles? 1 : sa->cycles > sb->cycles? -1 : 0;
+}
+
+
+
+static int
+traceFile(const char* file, size_t slowest)
+{
+    /*  Print the steps that took longest. This needs the library built
+        with trace=yes, see the run_test_trace target.
+    */
+    static const size_t RingSize = 4096;
+
+    MimeMagicTraceEntry*    entries = calloc(RingSize, sizeof(MimeMagicTraceEntry));
+    TraceStep*              steps   = calloc(RingSize, sizeof(TraceStep));
+    MimeMagicTrace          trace   = {entries, RingSize, 0, 0};
+    unsigned long long      prev;
+    unsigned long long      total;
+    const char*             mime;
+    Byte*                   buf;
+    size_t                  len;
+    size_t                  n, first, i;
+    int                     r;
+
+    readfile(file, &buf, &len);
+    r = getMimeTypeTraced(buf, len, &mime, MimeMagicNone, &trace);
+
+    if (trace.count == 0)
+    {
+        printf("The library was built without tracing\n");
+        return 1;
+    }
+
+    // The ring may have wrapped, then the time before the oldest is lost.
+    n     = trace.count < RingSize? trace.count : RingSize;
+    first = trace.count - n;
+    prev  = first == 0? trace.start : entries[first % RingSize].cycles;
+
+    for (i = 0; i < n; ++i)
+    {
+        const MimeMagicTraceEntry* e = &entries[(first + i) % RingSize];
+
+        steps[i].entry  = e;
+        steps[i].cycles = e->cycles - prev;
+        prev = e->cycles;
+    }
+
+    total = prev - trace.start;
+    qsort(steps, n, sizeof(TraceStep), compareSteps);
+
+    printf("%s: %s, %zu tests, %llu cycles\n", file, r > 0? mime : "unrecognised", trace.count, total);
+
+    for (i = 0; i < n && i < slowest; ++i)
+    {
+        const MimeMagicTraceEntry* e = steps[i].entry;
+
+        printf("    line %5u  %2d  offset %8zu  %10llu cycles  %4.1f%%\n", e->line, e->result,
+               e->offset, steps[i].cycles, 100.0 * steps[i].cycles / total);
+    }
+
+    free(buf);
+    free(entries);
+    free(steps);
+    return 0;
+}
+
+//======================================================================
+
+static int
+sampleCheck(const char* path, const char** files, size_t numFiles)
+{
+    /*  Sample every call while the files are classified, then replay the
+        samples from the file. A sample that holds all of its input must
+        give the same result again. This needs the library built with
+        sample=yes, see the run_test_sample target. With no files the
+        samples already in the file are replayed as a benchmark.
+    */
+    MimeMagicSample rec;
+    Byte*           data = malloc(MimeMagicSampleMaxBytes);
+    char            mime[256];
+    char            magic[8];
+    size_t          samples = 0, whole = 0, failed = 0;
+    double          recorded = 0, replayed = 0;
+    FILE*           fp;
+    size_t          i;
+
+    if (numFiles > 0)
+    {
+        if (mimeMagicSampleStart(path, 1, MimeMagicSampleMaxBytes) != 0)
+        {
+            printf("The library was built without sampling\n");
+            return 1;
+        }
+
+        for (i = 0; i < numFiles; ++i)
+        {
+            const char* m;
+            Byte*       buf;
+            size_t      len;
+
+            readfile(files[i], &buf, &len);
+            getMimeType(buf, len, &m, MimeMagicNone);
+            free(buf);
+        }
+
+        printf("%llu samples dropped\n", mimeMagicSampleStop());
+    }
+
+    if (!(fp = fopen(path, "rb")) || fread(magic, 1, 8, fp) != 8 || memcmp(magic, "MMSAMPL1", 8) != 0)
+    {
+        printf("%s is not a sample file\n", path);
+        return 1;
+    }
+
+    while (fread(&rec, sizeof(rec), 1, fp) == 1 &&
+           rec.mimeLen < sizeof(mime) && rec.bytes <= MimeMagicSampleMaxBytes &&
+           fread(mime, 1, rec.mimeLen, fp) == rec.mimeLen &&
+           fread(data, 1, rec.bytes, fp) == rec.bytes)
+    {
+        struct timespec start;
+        struct timespec stop;
+        const char*     m;
+        int             r = 0;
+        int             k;
+
+        mime[rec.mimeLen] = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for (k = 0; k < 100; ++k)
+        {
+            r = getMimeType(data, rec.bytes, &m, rec.flags);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        replayed += elapsed(&start, &stop) / 100;
+        recorded += rec.nanoseconds / 1e3;
+        ++samples;
+
+        if (rec.bytes == rec.length)
+        {
+            ++whole;
+
+            if (r != rec.result || strcmp(r > 0? m : "", mime) != 0)
+            {
+                printf("Failed: a sample of %u bytes gives %s, it was %s\n", rec.bytes,
+                       r > 0? m : "unrecognised", rec.mimeLen? mime : "unrecognised");
+                ++failed;
+            }
+        }
+    }
+
+    fclose(fp);
+    free(data);
+
+    printf("%zu samples, %zu whole, %zu failed, mean %.2f usecs recorded, %.2f usecs replayed\n",
+           samples, whole, failed, samples? recorded / samples : 0, samples? replayed / samples : 0);
+    return failed != 0;
+}
+
+//======================================================================
+
+typedef struct CarveImage
+{
+    const size_t*   starts;     // of the files, in order
+    size_t          numFiles;
+    size_t          next;       // the next file start not yet reached
+    size_t          found;      // of the file starts
+    size_t          matches;
+    size_t          last;       // offset of the last match
+    int             unordered;  // a match came before the one before it
+} CarveImage;
+
+
+
+static int
+carveFound(void* context, size_t offset, const char* mime)
+{
+    CarveImage* image = (CarveImage*)context;
+
+    if (image->matches > 0 && offset <= image->last)
+    {
+        image->unordered = 1;
+    }
+
+    image->last = offset;
+
+    while (image->next < image->numFiles && image->starts[image->next] < offset)
+    {
+        ++image->next;
+    }
+
+    if (image->next < image->numFiles && image->starts[image->next] == offset)
+    {
+        ++image->found;
+    }
+
+    ++image->matches;
+    return 0;
+}
+
+
+
+static int
+carvePerf(const char** files, size_t numFiles, size_t rounds, size_t minFound)
+{
+    /*  The files are laid end to end at 512 byte boundaries as in a disk
+        image and carved. We report how many of the file starts were
+        found, all of the matches and the throughput. It fails if fewer
+        than minFound starts were found or they weren't in order.
+    */
+    static const size_t Sector = 512;
+
+    size_t*     starts = calloc(numFiles, sizeof(size_t));
+    Byte*       image  = 0;
+    size_t      len    = 0;
+    double      total  = 0;
+    CarveImage  ci;
+    size_t      r, i;
+    int         err    = 0;
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        Byte*   data;
+        size_t  dlen;
+
+        readfile(files[i], &data, &dlen);
+        starts[i] = len;
+        image     = realloc(image, len + dlen + Sector);
+        memcpy(image + len, data, dlen);
+        len += dlen;
+        memset(image + len, 0, Sector - len % Sector);
+        len += Sector - len % Sector;
+        free(data);
+    }
+
+    for (r = 0; r < rounds; ++r)
+    {
+        struct timespec start;
+        struct timespec stop;
+
+        memset(&ci, 0, sizeof(ci));
+        ci.starts   = starts;
+        ci.numFiles = numFiles;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        mimeMagicCarve(image, len, carveFound, &ci);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        total += elapsed(&start, &stop);
+    }
+
+    printf("%zu bytes, %zu of %zu file starts found, %zu matches, %.0f MB/sec\n",
+           len, ci.found, numFiles, ci.matches, len * rounds / total);
+
+    if (ci.found < minFound)
+    {
+        printf("Failed: %zu file starts found, not %zu\n", ci.found, minFound);
+        err = 1;
+    }
+
+    if (ci.unordered)
+    {
+        printf("Failed: the matches were not in order of offset\n");
+        err = 1;
+    }
+
+    free(image);
+    free(starts);
+    return err;
+}
+
+//======================================================================
+
+static char*
+base64Encode(const Byte* data, size_t len, int variant, size_t* textLen)
+{
+    /*  Variant 0 is standard base64 on one line, 1 has CRLF every 76
+        characters as in email and 2 is URL-safe without padding.
+    */
+    static const char Std[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static const char Url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    const char* digits = variant == 2? Url : Std;
+    char*       text   = malloc(len / 3 * 4 + len / 57 * 2 + 8);
+    size_t      n      = 0;
+    size_t      i;
+
+    for (i = 0; i < len; i += 3)
+    {
+        uint32_t group = data[i] << 16;
+        size_t   k     = len - i < 3? len - i : 3;
+
+        group |= k > 1? data[i + 1] << 8 : 0;
+        group |= k > 2? data[i + 2] : 0;
+
+        text[n++] = digits[group >> 18 & 63];
+        text[n++] = digits[group >> 12 & 63];
+
+        if (k > 1 || variant != 2)
+        {
+            text[n++] = k > 1? digits[group >> 6 & 63] : '=';
+        }
+
+        if (k > 2 || variant != 2)
+        {
+            text[n++] = k > 2? digits[group & 63] : '=';
+        }
+
+        if (variant == 1 && (i + 3) % 57 == 0)
+        {
+            text[n++] = '\r';
+            text[n++] = '\n';
+        }
+    }
+
+    *textLen = n;
+    return text;
+}
+
+
+
+static char*
+dataUri(const char* header, const void* payload, size_t len, size_t* textLen)
+{
+    size_t  hlen = strlen(header);
+    char*   text = malloc(hlen + len);
+
+    memcpy(text, header, hlen);
+    memcpy(text + hlen, payload, len);
+    *textLen = hlen + len;
+    return text;
+}
+
+
+
+static char*
+percentEncode(const Byte* data, size_t len, size_t* textLen)
+{
+    // All but letters and digits as %XX, as encodeURIComponent() would.
+    static const char Hex[] = "0123456789ABCDEF";
+
+    char*   text = malloc(3 * len + 1);
+    size_t  n    = 0;
+    size_t  i;
+
+    for (i = 0; i < len; ++i)
+    {
+        Byte c = data[i];
+
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))
+        {
+            text[n++] = c;
+        }
+        else
+        {
+            text[n++] = '%';
+            text[n++] = Hex[c >> 4];
+            text[n++] = Hex[c & 15];
+        }
+    }
+
+    *textLen = n;
+    return text;
+}
+
+
+
+static int
+base64Check(const char** files, size_t numFiles)
+{
+    /*  Each file is encoded in each variant and the first as a data: URI.
+        Classifying the text must give the same as the raw file unless a
+        rule needs the end of a file that is too long to decode, when the
+        result is -1. A data: URI without ;base64 has the file %-escaped
+        as its payload, which must decode to the same.
+    */
+    size_t  failed = 0;
+    size_t  tail   = 0;
+    size_t  i;
+    int     v;
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        Byte*       data;
+        size_t      dlen;
+        const char* mime1;
+        int         r1;
+
+        readfile(files[i], &data, &dlen);
+        r1 = getMimeType(data, dlen, &mime1, MimeMagicNone);
+
+        for (v = 0; v < 5; ++v)
+        {
+            size_t      tlen;
+            char*       text = base64Encode(data, dlen, v < 3? v : 0, &tlen);
+            const char* mime2;
+            int         r2;
+
+            if (v == 3)
+            {
+                char* uri = dataUri("data:application/octet-stream;base64,", text, tlen, &tlen);
+
+                free(text);
+                text = uri;
+            }
+            else
+            if (v == 4)
+            {
+                char* escaped;
+
+                free(text);
+                escaped = percentEncode(data, dlen, &tlen);
+                text    = dataUri("data:application/octet-stream,", escaped, tlen, &tlen);
+                free(escaped);
+            }
+
+            r2 = getMimeTypeBase64(text, tlen, &mime2, MimeMagicNone);
+
+            if (r2 < 0 && r1 >= 0)
+            {
+                ++tail;
+            }
+            else
+            if (r1 != r2 || mime1 != mime2)
+            {
+                printf("Failed: %s in base64 variant %d gives %s, not %s\n", files[i], v,
+                       mime2 ? mime2 : "unrecognised",
+                       mime1 ? mime1 : "unrecognised");
+                ++failed;
+            }
+
+            free(text);
+        }
+
+        free(data);
+    }
+
+    printf("%zu files in base64 agree, %zu need the end of the file, %zu failed\n",
+           numFiles * 5 - failed - tail, tail, failed);
+    return failed != 0;
+}
+
+//======================================================================
+
+static size_t
+residentPages(const Byte* map, size_t pages)
+{
+    unsigned char   vec[pages];
+    size_t          n = 0;
+    size_t          i;
 
-    while (nsecs < 0)
+    if (mincore((void*)map, pages * sysconf(_SC_PAGESIZE), vec) != 0)
     {
-        secs -= 1;
-        nsecs += 1000000000;
+        perror("mincore");
+        exit(1);
     }
 
-    tm = (1000000 * (secs + nsecs / 1000000000.0)) / count;
+    for (i = 0; i < pages; ++i)
+    {
+        n += vec[i] & 1;
+    }
 
-    printf("%s: time %.1f usecs\n", testFile, tm);
+    return n;
+}
+
+
+
+static Byte*
+mapFirstPage(const Byte* data, size_t dlen, size_t pages)
+{
+    // Only the first page is written so the rest are not resident.
+    size_t  pageSize = sysconf(_SC_PAGESIZE);
+    Byte*   map = mmap(NULL, pages * pageSize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(1);
+    }
+
+    memcpy(map, data, dlen < pageSize? dlen : pageSize);
+    return map;
+}
+
+
+
+static int
+faultCheck(const char** files, size_t numFiles)
+{
+    /*  Each file is cut to its first page and put at the start of a 64KB
+        anonymous mapping, as a small file mapped in a larger window would
+        be. The rest of the mapping is zero and not yet resident. We
+        count the pages that a call faults in with and without
+        MimeMagicDeferFaults. The far tests can't match zeroes so the
+        results must agree.
+    */
+    static const size_t Pages = 16;
+
+    size_t  pageSize = sysconf(_SC_PAGESIZE);
+    int     failed = 0;
+    size_t  i;
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        Byte*       data;
+        size_t      dlen;
+        Byte*       plain;
+        Byte*       defer;
+        const char* mime1 = 0;
+        const char* mime2 = 0;
+        int         r1, r2;
+        size_t      n1, n2;
+
+        readfile(files[i], &data, &dlen);
+        plain = mapFirstPage(data, dlen, Pages);
+        defer = mapFirstPage(data, dlen, Pages);
+
+        r1 = getMimeType(plain, Pages * pageSize, &mime1, MimeMagicNone);
+        r2 = getMimeType(defer, Pages * pageSize, &mime2, MimeMagicDeferFaults);
+        n1 = residentPages(plain, Pages);
+        n2 = residentPages(defer, Pages);
+
+        printf("%-16s %2zu pages, %2zu deferring  %s\n", files[i], n1, n2, r2 > 0? mime2 : "-");
+
+        if ((r1 > 0) != (r2 > 0) || (r1 > 0 && strcmp(mime1, mime2) != 0) || n2 > n1)
+        {
+            printf("Failed: %s, %s without deferring\n", files[i], r1 > 0? mime1 : "-");
+            failed = 1;
+        }
+
+        munmap(plain, Pages * pageSize);
+        munmap(defer, Pages * pageSize);
+        free(data);
+    }
+
+    return failed;
+}
+
+//======================================================================
+
+/*  A pool of one worker with a queue, as a caller might supply. The
+    classifying is done on the worker and submits its tasks to the same
+    queue, behind itself, so they can't start until the call returns.
+*/
+enum
+{
+    PoolQueue = 64,
+};
+
+typedef struct PoolTask
+{
+    void      (*fn)(void* arg);
+    void*       arg;
+} PoolTask;
+
+typedef struct Pool
+{
+    PoolTask        queue[PoolQueue];
+    size_t          head;
+    size_t          count;
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+} Pool;
+
+typedef struct PoolJob
+{
+    const Byte*     buf;
+    size_t          len;
+    const MimeMagicExecutor* exec;
+    const char*     mime;
+    int             result;
+    int             done;
+} PoolJob;
+
+
+
+static int
+poolSubmit(void* context, void (*fn)(void* arg), void* arg)
+{
+    Pool*   pool = (Pool*)context;
+    int     err  = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    if (pool->count == PoolQueue)
+    {
+        err = 1;
+    }
+    else
+    {
+        PoolTask* task = &pool->queue[(pool->head + pool->count++) % PoolQueue];
+
+        task->fn  = fn;
+        task->arg = arg;
+        pthread_cond_broadcast(&pool->changed);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return err;
+}
+
+
+
+static void*
+poolWorker(void* arg)
+{
+    // A task with no function stops the worker.
+    Pool*       pool = (Pool*)arg;
+    PoolTask    task;
+
+    do
+    {
+        pthread_mutex_lock(&pool->lock);
+
+        while (pool->count == 0)
+        {
+            pthread_cond_wait(&pool->changed, &pool->lock);
+        }
+
+        task = pool->queue[pool->head];
+        pool->head = (pool->head + 1) % PoolQueue;
+        --pool->count;
+        pthread_mutex_unlock(&pool->lock);
+
+        if (task.fn)
+        {
+            task.fn(task.arg);
+        }
+    }
+    while (task.fn);
+
+    return NULL;
+}
+
+
+
+static void
+poolJob(void* arg)
+{
+    PoolJob* job = (PoolJob*)arg;
+
+    job->result = getMimeTypeParallel(job->buf, job->len, &job->mime, MimeMagicNone, job->exec, 1);
+    __atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
 }
 
 
+
+static int
+poolCheck(const char** files, size_t numFiles)
+{
+    /*  Each file is classified by getMimeTypeParallel() on the one worker
+        of a pool. It must give the same as getMimeType() and not wait for
+        the tasks queued behind it.
+    */
+    Pool        pool;
+    pthread_t   worker;
+    int         failed = 0;
+    size_t      i;
+
+    MimeMagicExecutor exec = {poolSubmit, &pool, 1};
+
+    memset(&pool, 0, sizeof(pool));
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.changed, NULL);
+    pthread_create(&worker, NULL, poolWorker, &pool);
+
+    for (i = 0; i < numFiles; ++i)
+    {
+        Byte*       data;
+        size_t      dlen;
+        const char* mime;
+        int         r;
+        int         waited;
+        PoolJob     job;
+
+        readfile(files[i], &data, &dlen);
+        r = getMimeType(data, dlen, &mime, MimeMagicNone);
+
+        memset(&job, 0, sizeof(job));
+        job.buf  = data;
+        job.len  = dlen;
+        job.exec = &exec;
+        poolSubmit(&pool, poolJob, &job);
+
+        for (waited = 0; waited < 10000 && !__atomic_load_n(&job.done, __ATOMIC_ACQUIRE); ++waited)
+        {
+            usleep(1000);
+        }
+
+        if (!job.done)
+        {
+            // The worker is stuck, so the job and the data stay.
+            printf("Failed: %s, no result from the worker after 10 seconds\n", files[i]);
+            return 1;
+        }
+
+        if (job.result != r || job.mime != mime)
+        {
+            printf("Failed: %s on a pool of one gives %s, not %s\n", files[i],
+                   job.mime ? job.mime : "unrecognised",
+                   mime ? mime : "unrecognised");
+            failed = 1;
+        }
+
+        free(data);
+    }
+
+    poolSubmit(&pool, NULL, NULL);
+    pthread_join(worker, NULL);
+    printf("%zu files on a pool of one, %s\n", numFiles, failed? "failed" : "all agree");
+    return failed;
+}
+
 //======================================================================
 
 
@@ -121,6 +1153,24 @@ main(int argc, char** argv)
     const char*     testFile = 0;
     const char*     expected = 0;
     size_t          perf     = 0;
+    double          ceiling  = 0;
+    int             stats    = 0;
+    int             events   = 0;
+    int             coldMode = 0;
+    int             batchMode = 0;
+    int             faultMode = 0;
+    int             poolMode = 0;
+    int             carveMode = 0;
+    size_t          carveMin = 0;
+    int             base64Mode = 0;
+    size_t          traceSteps = 0;
+    const char*     sampleFile = 0;
+    size_t          evictKB  = 8192;
+    size_t          headTail = 0;
+    const char*     expectedInfo = 0;
+    const char*     expectedRange = 0;
+    const char*     expectedText = 0;       // the -I or -R argument
+    char            infoText[100] = "";
     Byte*           buffer   = 0;
     size_t          numBytes;
     const char*     mimeType = 0;
@@ -128,10 +1178,34 @@ main(int argc, char** argv)
     int opt;
     int err;
 
-    while ((opt = getopt(argc, argv, "hpP:f:m:")) != -1)
+    while ((opt = getopt(argc, argv, "b:BcDeEhH:I:KL:N:pP:f:m:R:sS:T:W")) != -1)
     {
         switch (opt)
         {
+        case 'b':
+            evictKB = atoi(optarg);
+            break;
+
+        case 'B':
+            batchMode = 1;
+            break;
+
+        case 'c':
+            coldMode = 1;
+            break;
+
+        case 'D':
+            faultMode = 1;
+            break;
+
+        case 'e':
+            events = 1;
+            break;
+
+        case 'E':
+            base64Mode = 1;
+            break;
+
         case 'f':
             testFile = optarg;
             break;
@@ -142,10 +1216,30 @@ main(int argc, char** argv)
             exit(0);
             break;
 
+        case 'H':
+            headTail = atoi(optarg);
+            break;
+
+        case 'I':
+            expectedInfo = optarg;
+            break;
+
+        case 'K':
+            carveMode = 1;
+            break;
+
+        case 'L':
+            ceiling = atof(optarg);
+            break;
+
         case 'm':
             expected = optarg;
             break;
 
+        case 'N':
+            carveMin = atoi(optarg);
+            break;
+
         case 'p':
             perf = 1000;
             break;
@@ -154,25 +1248,144 @@ main(int argc, char** argv)
             perf = atoi(optarg);
             break;
 
+        case 'R':
+            expectedRange = optarg;
+            break;
+
+        case 's':
+            stats = 1;
+            break;
+
+        case 'S':
+            sampleFile = optarg;
+            break;
+
+        case 'T':
+            traceSteps = atoi(optarg);
+            break;
+
+        case 'W':
+            poolMode = 1;
+            break;
+
         default:
             usage();
             exit(EXIT_FAILURE);
         }
     }
 
+    if (sampleFile)
+    {
+        return sampleCheck(sampleFile, (const char**)argv + optind, argc - optind);
+    }
+
+    if (coldMode || batchMode || faultMode || poolMode || carveMode || base64Mode)
+    {
+        // The files are -f and any remaining arguments.
+        const char** files = calloc(argc + 1, sizeof(char*));
+        size_t       n     = 0;
+
+        if (testFile)
+        {
+            files[n++] = testFile;
+        }
+
+        for (; optind < argc; ++optind)
+        {
+            files[n++] = argv[optind];
+        }
+
+        if (n == 0 || evictKB == 0)
+        {
+            usage();
+            exit(1);
+        }
+
+        if (faultMode)
+        {
+            err = faultCheck(files, n);
+            free(files);
+            return err;
+        }
+
+        if (poolMode)
+        {
+            err = poolCheck(files, n);
+            free(files);
+            return err;
+        }
+
+        if (base64Mode)
+        {
+            err = base64Check(files, n);
+            free(files);
+            return err;
+        }
+
+        if (carveMode)
+        {
+            err = carvePerf(files, n, perf? perf : 20, carveMin);
+            free(files);
+            return err;
+        }
+
+        if (batchMode)
+        {
+            batchPerf(files, n, perf? perf : 20);
+        }
+        else
+        {
+            coldPerf(files, n, perf? perf : 100, evictKB);
+        }
+
+        free(files);
+        return 0;
+    }
+
     if (!testFile)
     {
         usage();
         exit(1);
     }
 
+    if (traceSteps)
+    {
+        return traceFile(testFile, traceSteps);
+    }
+
     readfile(testFile, &buffer, &numBytes);
 
+    if (events)
+    {
+        // Count hardware events over a batch of calls after one to warm up.
+        Counters ctrs;
+
+        if (!perf)
+        {
+            perf = 1000;
+        }
+
+        countersOpen(&ctrs);
+        err = getMimeType(buffer, numBytes, &mimeType, MimeMagicNone);
+
+        countersStart(&ctrs);
+
+        for (size_t i = 0; i < perf; ++i)
+        {
+            getMimeType(buffer, numBytes, &mimeType, MimeMagicNone);
+        }
+
+        countersStop(&ctrs);
+        countersReport(&ctrs, testFile, perf);
+        countersClose(&ctrs);
+    }
+    else
     if (perf)
     {
         // For performance run this 1000 times.
         struct timespec start;
         struct timespec stop;
+        double          tm;
 
         clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
 
@@ -183,11 +1396,53 @@ main(int argc, char** argv)
         }
 
         clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &stop);
-        reportTime(testFile, &start, &stop, perf);
+
+        tm = reportTime(testFile, &start, &stop, perf);
+
+        // With a ceiling the mean time decides the exit status.
+        if (ceiling > 0)
+        {
+            err = tm <= ceiling;
+
+            if (!err)
+            {
+                printf("Failed: %s, over the ceiling of %.1f usecs\n", testFile, ceiling);
+            }
+        }
     }
     else
     {
-        err = getMimeType(buffer, numBytes, &mimeType, MimeMagicNone);
+        if (headTail)
+        {
+            // Only the first and last few bytes, as from an object store.
+            size_t n = headTail < numBytes? headTail : numBytes;
+
+            err = getMimeTypeHeadTail(buffer, n, buffer + numBytes - n, n, numBytes,
+                                      &mimeType, MimeMagicNone);
+        }
+        else
+        if (expectedInfo)
+        {
+            MimeMagicInfo info;
+
+            err = getMimeTypeInfo(buffer, numBytes, &mimeType, &info, MimeMagicNone);
+            formatInfo(&info, infoText, sizeof(infoText));
+            expectedText = expectedInfo;
+        }
+        else
+        if (expectedRange)
+        {
+            MimeMagicMatch match;
+
+            // The lines move with the magic file so only the range is checked.
+            err = getMimeTypeMatch(buffer, numBytes, &mimeType, &match, MimeMagicNone);
+            snprintf(infoText, sizeof(infoText), "%zu-%zu", match.start, match.end);
+            expectedText = expectedRange;
+        }
+        else
+        {
+            err = getMimeType(buffer, numBytes, &mimeType, MimeMagicNone);
+        }
 
         if (expected)
         {
@@ -197,11 +1452,23 @@ main(int argc, char** argv)
                 mimeType = expected;
             }
             else
+            if (strcmp("none", expected) == 0)
+            {
+                err = (err == 0);
+                mimeType = expected;
+            }
+            else
             if (err > 0)
             {
                 err = (strcmp(mimeType, expected) == 0);
             }
 
+            if (err > 0 && expectedText && strcmp(infoText, expectedText) != 0)
+            {
+                printf("Failed: %s, %s, not %s\n", testFile, infoText, expectedText);
+                err = 0;
+            }
+            else
             if (err > 0)
             {
                 printf("Passed: %s: %s\n", testFile, mimeType);
@@ -224,6 +1491,21 @@ main(int argc, char** argv)
         }
     }
 
+    if (stats)
+    {
+        char* text = mimeMagicStatsSnapshot(MimeMagicStatsPrometheus);
+
+        if (text)
+        {
+            fputs(text, stdout);
+            free(text);
+        }
+        else
+        {
+            printf("The library was built without statistics\n");
+        }
+    }
+
     if (buffer)
     {
         free(buffer);
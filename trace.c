@@ -0,0 +1,57 @@
+/*
+    Copyright (c) Anthony L. Shipman, 2015
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+    1. Redistributions of source code must retain the above copyright
+       notice immediately at the beginning of the file, without modification,
+       this list of conditions, and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE FOR
+    ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+*/
+
+/*  getMimeTypeTraced(). The ring is set for the calling thread during
+    the call so that the generated code needn't pass it around. The
+    tests that getMimeTypeParallel() runs on other threads aren't seen.
+*/
+
+//======================================================================
+
+int
+getMimeTypeTraced(const Byte* buf, size_t len, const char** mime, int flags, MimeMagicTrace* trace)
+{
+    int r;
+
+    trace->count = 0;
+    trace->start = 0;
+
+#ifdef MIMEMAGIC_TRACE
+    if (trace->size > 0)
+    {
+        trace->start = traceClock();
+        traceRing    = trace;
+    }
+#endif
+
+    r = getMimeType(buf, len, mime, flags);
+
+#ifdef MIMEMAGIC_TRACE
+    traceRing = NULL;
+#endif
+
+    return r;
+}
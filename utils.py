@@ -35,7 +35,10 @@ def addIndent(lines, levels):
     extra = mkIndent(levels)
     strm  = OStream()
     for l in lines.splitlines(True):
-        strm.write(extra + l)
+        if l.strip():
+            strm.write(extra + l)
+        else:
+            strm.write(l)
     return str(strm)
 
 #======================================================================